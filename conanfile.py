@@ -86,6 +86,7 @@ class Xrpl(ConanFile):
         'soci/*:with_sqlite3': True,
         'soci/*:with_boost': True,
         'xxhash/*:shared': False,
+        'zstd/*:shared': False,
     }
 
     def set_version(self):
@@ -116,6 +117,7 @@ class Xrpl(ConanFile):
         if self.options.rocksdb:
             self.requires('rocksdb/10.0.1')
         self.requires('xxhash/0.8.3', **transitive_headers_opt)
+        self.requires('zstd/1.5.7', force=True)
 
     exports_sources = (
         'CMakeLists.txt',
@@ -192,6 +194,7 @@ class Xrpl(ConanFile):
             'sqlite3::sqlite',
             'xxhash::xxhash',
             'zlib::zlib',
+            'zstd::zstdlib',
         ]
         if self.options.rocksdb:
             libxrpl.requires.append('rocksdb::librocksdb')
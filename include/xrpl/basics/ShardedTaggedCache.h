@@ -0,0 +1,310 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#ifndef RIPPLE_BASICS_SHARDEDTAGGEDCACHE_H_INCLUDED
+#define RIPPLE_BASICS_SHARDEDTAGGEDCACHE_H_INCLUDED
+
+#include <xrpl/basics/TaggedCache.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ripple {
+
+/** A TaggedCache split into independently locked shards.
+
+    TaggedCache protects all of its entries with a single mutex, so every
+    lookup contends with every other lookup, and with the sweep. This cache
+    instead assigns each key to one of several TaggedCache shards by the hash
+    of the key, like partitioned_unordered_map assigns keys to partitions.
+    Operations on keys in different shards do not contend, and the cache is
+    swept one shard at a time, so a sweep only ever holds up the operations
+    on one shard.
+
+    A key always belongs to the same shard, so every operation on a key
+    behaves as it does in TaggedCache. The sizes and counts are the sums over
+    the shards. There is no mutex over the whole cache; code which needs one
+    must use TaggedCache and its peekMutex().
+
+    @note The member functions forward to TaggedCache, so code using them
+          must include TaggedCache.ipp.
+*/
+template <
+    class Key,
+    class T,
+    bool IsKeyCache = false,
+    class SharedWeakUnionPointerType = SharedWeakCachePointer<T>,
+    class SharedPointerType = std::shared_ptr<T>,
+    class Hash = hardened_hash<>,
+    class KeyEqual = std::equal_to<Key>,
+    class Mutex = std::recursive_mutex>
+class ShardedTaggedCache
+{
+public:
+    using shard_type = TaggedCache<
+        Key,
+        T,
+        IsKeyCache,
+        SharedWeakUnionPointerType,
+        SharedPointerType,
+        Hash,
+        KeyEqual,
+        Mutex>;
+    using key_type = Key;
+    using mapped_type = T;
+    using clock_type = typename shard_type::clock_type;
+    using shared_pointer_type = SharedPointerType;
+
+    /** Create the cache.
+
+        @param size The desired number of cached entries, split evenly
+                    between the shards. Zero means no limit.
+        @param shards The number of shards. Zero means one for each hardware
+                      thread.
+    */
+    ShardedTaggedCache(
+        std::string const& name,
+        int size,
+        typename clock_type::duration expiration,
+        clock_type& clock,
+        beast::Journal journal,
+        std::size_t shards = 0)
+        : m_clock(clock)
+    {
+        if (shards == 0)
+            shards = std::max(1u, std::thread::hardware_concurrency());
+
+        int const shardSize =
+            (size + static_cast<int>(shards) - 1) / static_cast<int>(shards);
+
+        m_shards.reserve(shards);
+        for (std::size_t i = 0; i < shards; ++i)
+        {
+            // A shard is small and swept on the caller's thread, so it does
+            // not need partitions of its own.
+            m_shards.push_back(std::make_unique<shard_type>(
+                name,
+                shardSize,
+                expiration,
+                clock,
+                journal,
+                beast::insight::NullCollector::New(),
+                1));
+        }
+    }
+
+    ShardedTaggedCache(ShardedTaggedCache const&) = delete;
+    ShardedTaggedCache&
+    operator=(ShardedTaggedCache const&) = delete;
+
+    /** Return the clock associated with the cache. */
+    clock_type&
+    clock()
+    {
+        return m_clock;
+    }
+
+    std::size_t
+    shards() const
+    {
+        return m_shards.size();
+    }
+
+    /** Returns the number of items in the container. */
+    std::size_t
+    size() const
+    {
+        return sum([](shard_type const& s) { return s.size(); });
+    }
+
+    int
+    getCacheSize() const
+    {
+        return sum([](shard_type const& s) { return s.getCacheSize(); });
+    }
+
+    int
+    getTrackSize() const
+    {
+        return sum([](shard_type const& s) { return s.getTrackSize(); });
+    }
+
+    /** Returns the mean of the hit rates of the shards, as a percentage.
+
+        Keys are spread evenly over the shards, so each shard sees about the
+        same share of the lookups.
+    */
+    float
+    getHitRate()
+    {
+        float total = 0;
+        for (auto& shard : m_shards)
+            total += shard->getHitRate();
+        return total / m_shards.size();
+    }
+
+    void
+    clear()
+    {
+        for (auto& shard : m_shards)
+            shard->clear();
+    }
+
+    void
+    reset()
+    {
+        for (auto& shard : m_shards)
+            shard->reset();
+    }
+
+    template <class KeyComparable>
+    bool
+    touch_if_exists(KeyComparable const& key)
+    {
+        return shard(key).touch_if_exists(key);
+    }
+
+    /** Sweep each shard in turn. */
+    void
+    sweep()
+    {
+        for (auto& shard : m_shards)
+            shard->sweep();
+    }
+
+    bool
+    del(key_type const& key, bool valid)
+    {
+        return shard(key).del(key, valid);
+    }
+
+    template <class R>
+    bool
+    canonicalize(
+        key_type const& key,
+        SharedPointerType& data,
+        R&& replaceCallback)
+    {
+        return shard(key).canonicalize(
+            key, data, std::forward<R>(replaceCallback));
+    }
+
+    bool
+    canonicalize_replace_cache(
+        key_type const& key,
+        SharedPointerType const& data)
+    {
+        return shard(key).canonicalize_replace_cache(key, data);
+    }
+
+    bool
+    canonicalize_replace_client(key_type const& key, SharedPointerType& data)
+    {
+        return shard(key).canonicalize_replace_client(key, data);
+    }
+
+    SharedPointerType
+    fetch(key_type const& key)
+    {
+        return shard(key).fetch(key);
+    }
+
+    template <class ReturnType = bool>
+    auto
+    insert(key_type const& key, T const& value)
+        -> std::enable_if_t<!IsKeyCache, ReturnType>
+    {
+        return shard(key).insert(key, value);
+    }
+
+    template <class ReturnType = bool>
+    auto
+    insert(key_type const& key) -> std::enable_if_t<IsKeyCache, ReturnType>
+    {
+        return shard(key).insert(key);
+    }
+
+    bool
+    retrieve(key_type const& key, T& data)
+    {
+        return shard(key).retrieve(key, data);
+    }
+
+    std::vector<key_type>
+    getKeys() const
+    {
+        std::vector<key_type> keys;
+        for (auto const& shard : m_shards)
+        {
+            auto const shardKeys = shard->getKeys();
+            keys.insert(keys.end(), shardKeys.begin(), shardKeys.end());
+        }
+        return keys;
+    }
+
+    /** Returns the mean of the fractions of cache hits of the shards. */
+    double
+    rate() const
+    {
+        double total = 0;
+        for (auto const& shard : m_shards)
+            total += shard->rate();
+        return total / m_shards.size();
+    }
+
+    template <class Handler>
+    SharedPointerType
+    fetch(key_type const& digest, Handler const& h)
+    {
+        return shard(digest).fetch(digest, h);
+    }
+
+private:
+    template <class KeyComparable>
+    shard_type&
+    shard(KeyComparable const& key)
+    {
+        return *m_shards[m_hash(key) % m_shards.size()];
+    }
+
+    template <class F>
+    auto
+    sum(F const& f) const
+    {
+        decltype(f(*m_shards.front())) total = 0;
+        for (auto const& shard : m_shards)
+            total += f(*shard);
+        return total;
+    }
+
+    clock_type& m_clock;
+
+    // Picks the shard of a key. This is seeded independently of the hash
+    // used by the maps within the shards.
+    Hash const m_hash;
+
+    std::vector<std::unique_ptr<shard_type>> m_shards;
+};
+
+}  // namespace ripple
+
+#endif
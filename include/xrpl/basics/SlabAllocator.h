@@ -160,6 +160,10 @@ private:
     // A linked list of slabs
     std::atomic<SlabBlock*> slabs_ = nullptr;
 
+    // The slab that most recently had free space, which allocate tries
+    // before searching the list:
+    std::atomic<SlabBlock*> hint_ = nullptr;
+
     // The alignment requirements of the item we're allocating:
     std::size_t const itemAlignment_;
 
@@ -170,6 +174,18 @@ private:
     // The size of each individual slab:
     std::size_t const slabSize_;
 
+    // Whether slabs are aligned to their size, which is when the size is a
+    // power of two. The slab that owns an item then starts at the address of
+    // the item rounded down to the slab size:
+    bool const aligned_;
+
+    // The number of bytes in the slabs allocated so far:
+    std::atomic<std::size_t> reserved_ = 0;
+
+    // The number of items allocated from and returned to the slabs:
+    std::atomic<std::uint64_t> allocations_ = 0;
+    std::atomic<std::uint64_t> deallocations_ = 0;
+
 public:
     /** Constructs a slab allocator able to allocate objects of a fixed size
 
@@ -187,6 +203,7 @@ public:
         , itemSize_(
               boost::alignment::align_up(sizeof(Type) + extra, itemAlignment_))
         , slabSize_(alloc)
+        , aligned_(alloc != 0 && (alloc & (alloc - 1)) == 0)
     {
         XRPL_ASSERT(
             (itemAlignment_ & (itemAlignment_ - 1)) == 0,
@@ -215,6 +232,31 @@ public:
         return itemSize_;
     }
 
+    /** Returns the number of bytes in the slabs allocated so far.
+
+        Slabs are never released and every page of a slab is touched when the
+        slab is carved up, so this is the memory the allocator keeps resident.
+     */
+    std::size_t
+    reserved() const noexcept
+    {
+        return reserved_.load(std::memory_order_relaxed);
+    }
+
+    /** Returns the number of items ever allocated from this allocator. */
+    std::uint64_t
+    allocations() const noexcept
+    {
+        return allocations_.load(std::memory_order_relaxed);
+    }
+
+    /** Returns the number of items ever returned to this allocator. */
+    std::uint64_t
+    deallocations() const noexcept
+    {
+        return deallocations_.load(std::memory_order_relaxed);
+    }
+
     /** Returns a suitably aligned pointer, if one is available.
 
         @return a pointer to a block of memory from the allocator, or
@@ -223,12 +265,25 @@ public:
     std::uint8_t*
     allocate() noexcept
     {
+        if (auto const slab = hint_.load(std::memory_order_acquire))
+        {
+            if (auto ret = slab->allocate())
+            {
+                allocations_.fetch_add(1, std::memory_order_relaxed);
+                return ret;
+            }
+        }
+
         auto slab = slabs_.load();
 
         while (slab != nullptr)
         {
             if (auto ret = slab->allocate())
+            {
+                hint_.store(slab, std::memory_order_release);
+                allocations_.fetch_add(1, std::memory_order_relaxed);
                 return ret;
+            }
 
             slab = slab->next_;
         }
@@ -238,9 +293,12 @@ public:
         std::size_t size = slabSize_;
 
         // We want to allocate the memory at a 2 MiB boundary, to make it
-        // possible to use hugepage mappings on Linux:
-        auto buf =
-            boost::alignment::aligned_alloc(megabytes(std::size_t(2)), size);
+        // possible to use hugepage mappings on Linux, or at a multiple of
+        // the slab size if that is larger, so deallocateOwned can find it:
+        auto buf = boost::alignment::aligned_alloc(
+            aligned_ ? std::max(megabytes(std::size_t(2)), size)
+                     : megabytes(std::size_t(2)),
+            size);
 
         // clang-format off
         if (!buf) [[unlikely]]
@@ -287,7 +345,15 @@ public:
             ;  // Nothing to do
         }
 
-        return slab->allocate();
+        reserved_.fetch_add(size, std::memory_order_relaxed);
+
+        auto ret = slab->allocate();
+        if (ret)
+        {
+            hint_.store(slab, std::memory_order_release);
+            allocations_.fetch_add(1, std::memory_order_relaxed);
+        }
+        return ret;
     }
 
     /** Returns the memory block to the allocator.
@@ -310,12 +376,35 @@ public:
             if (slab->own(ptr))
             {
                 slab->deallocate(ptr);
+                deallocations_.fetch_add(1, std::memory_order_relaxed);
                 return true;
             }
         }
 
         return false;
     }
+
+    /** Returns a memory block that came from this allocator.
+
+        Unlike deallocate, this finds the slab that owns the block from its
+        address rather than by searching, so it requires a slab size that is
+        a power of two.
+
+        @param ptr A pointer returned by allocate.
+     */
+    void
+    deallocateOwned(std::uint8_t* ptr) noexcept
+    {
+        XRPL_ASSERT(
+            ptr && aligned_,
+            "ripple::SlabAllocator::SlabAllocator::deallocateOwned : "
+            "non-null input and aligned slabs");
+
+        auto const slab = reinterpret_cast<SlabBlock*>(
+            reinterpret_cast<std::uintptr_t>(ptr) & ~(slabSize_ - 1));
+        slab->deallocate(ptr);
+        deallocations_.fetch_add(1, std::memory_order_relaxed);
+    }
 };
 
 /** A collection of slab allocators of various sizes for a given type. */
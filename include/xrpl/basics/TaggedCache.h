@@ -31,6 +31,7 @@
 #include <atomic>
 #include <functional>
 #include <mutex>
+#include <optional>
 #include <thread>
 #include <type_traits>
 #include <vector>
@@ -76,7 +77,8 @@ public:
         clock_type& clock,
         beast::Journal journal,
         beast::insight::Collector::ptr const& collector =
-            beast::insight::NullCollector::New());
+            beast::insight::NullCollector::New(),
+        std::optional<std::size_t> partitions = std::nullopt);
 
 public:
     /** Return the clock associated with the cache. */
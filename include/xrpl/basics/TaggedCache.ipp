@@ -49,7 +49,8 @@ inline TaggedCache<
         clock_type::duration expiration,
         clock_type& clock,
         beast::Journal journal,
-        beast::insight::Collector::ptr const& collector)
+        beast::insight::Collector::ptr const& collector,
+        std::optional<std::size_t> partitions)
     : m_journal(journal)
     , m_clock(clock)
     , m_stats(name, std::bind(&TaggedCache::collect_metrics, this), collector)
@@ -57,6 +58,7 @@ inline TaggedCache<
     , m_target_size(size)
     , m_target_age(expiration)
     , m_cache_count(0)
+    , m_cache(partitions)
     , m_hits(0)
     , m_misses(0)
 {
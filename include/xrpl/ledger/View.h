@@ -1127,9 +1127,32 @@ deleteAMMTrustLine(
     std::optional<AccountID> const& ammAccountID,
     beast::Journal j);
 
+/** The vault and share issuance values used to convert between assets and
+    shares.
+
+    Each conversion reads several fields of the vault and of the issuance of
+    its shares. Transactions that convert more than once read them once into
+    this, and pass it to each conversion. It must not outlive any change to
+    the vault or the issuance.
+*/
+struct VaultConversion
+{
+    Asset asset;
+    MPTIssue share;
+    std::uint8_t scale;
+    Number assetsTotal;
+    Number lossUnrealized;
+    Number sharesTotal;
+
+    VaultConversion(SLE const& vault, SLE const& issuance);
+};
+
 // From the perspective of a vault, return the number of shares to give the
 // depositor when they deposit a fixed amount of assets. Since shares are MPT
 // this number is integral and always truncated in this calculation.
+[[nodiscard]] std::optional<STAmount>
+assetsToSharesDeposit(VaultConversion const& vault, STAmount const& assets);
+
 [[nodiscard]] std::optional<STAmount>
 assetsToSharesDeposit(
     std::shared_ptr<SLE const> const& vault,
@@ -1139,6 +1162,9 @@ assetsToSharesDeposit(
 // From the perspective of a vault, return the number of assets to take from
 // depositor when they receive a fixed amount of shares. Note, since shares are
 // MPT, they are always an integral number.
+[[nodiscard]] std::optional<STAmount>
+sharesToAssetsDeposit(VaultConversion const& vault, STAmount const& shares);
+
 [[nodiscard]] std::optional<STAmount>
 sharesToAssetsDeposit(
     std::shared_ptr<SLE const> const& vault,
@@ -1151,6 +1177,12 @@ enum class TruncateShares : bool { no = false, yes = true };
 // the depositor when they ask to withdraw a fixed amount of assets. Since
 // shares are MPT this number is integral, and it will be rounded to nearest
 // unless explicitly requested to be truncated instead.
+[[nodiscard]] std::optional<STAmount>
+assetsToSharesWithdraw(
+    VaultConversion const& vault,
+    STAmount const& assets,
+    TruncateShares truncate = TruncateShares::no);
+
 [[nodiscard]] std::optional<STAmount>
 assetsToSharesWithdraw(
     std::shared_ptr<SLE const> const& vault,
@@ -1161,6 +1193,9 @@ assetsToSharesWithdraw(
 // From the perspective of a vault, return the number of assets to give the
 // depositor when they redeem a fixed amount of shares. Note, since shares are
 // MPT, they are always an integral number.
+[[nodiscard]] std::optional<STAmount>
+sharesToAssetsWithdraw(VaultConversion const& vault, STAmount const& shares);
+
 [[nodiscard]] std::optional<STAmount>
 sharesToAssetsWithdraw(
     std::shared_ptr<SLE const> const& vault,
@@ -20,12 +20,14 @@
 #ifndef RIPPLE_PROTOCOL_DIGEST_H_INCLUDED
 #define RIPPLE_PROTOCOL_DIGEST_H_INCLUDED
 
+#include <xrpl/basics/Slice.h>
 #include <xrpl/basics/base_uint.h>
 #include <xrpl/crypto/secure_erase.h>
 
 #include <boost/endian/conversion.hpp>
 
 #include <array>
+#include <span>
 
 namespace ripple {
 
@@ -245,6 +247,19 @@ sha512Half_s(Args const&... args)
     return static_cast<typename sha512_half_hasher_s::result_type>(h);
 }
 
+/** Computes the SHA512-Half of each of several messages.
+
+    The digests are the same as those of sha512Half, but on CPUs with AVX2 or
+    AVX-512, four or eight messages are hashed at once. This is fastest when
+    the messages are about the same size, like the inner nodes of a SHAMap.
+
+    @param messages The messages to hash.
+    @param digests Receives the digest of each message. It must be the same
+                   size as messages.
+*/
+void
+sha512HalfBatch(std::span<Slice const> messages, std::span<uint256> digests);
+
 }  // namespace ripple
 
 #endif
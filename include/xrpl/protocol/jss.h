@@ -215,6 +215,9 @@ JSS(converge_time_s);         // out: NetworkOPs
 JSS(cookie);                  // out: NetworkOPs
 JSS(count);                   // in: AccountTx*, ValidatorList
 JSS(counters);                // in/out: retrieve counters
+JSS(cover_available);         // out: LoanBrokerInfo
+JSS(cover_minimum);           // out: LoanBrokerInfo
+JSS(cover_ratio);             // out: LoanBrokerInfo
 JSS(credentials);             // in: deposit_authorized
 JSS(credential_type);         // in: LedgerEntry DepositPreauth
 JSS(ctid);                    // in/out: Tx RPC
@@ -232,6 +235,7 @@ JSS(date);                    // out: tx/Transaction, NetworkOPs
 JSS(dbKBLedger);              // out: getCounts
 JSS(dbKBTotal);               // out: getCounts
 JSS(dbKBTransaction);         // out: getCounts
+JSS(debt_total);              // out: LoanBrokerInfo
 JSS(debug_signing);           // in: TransactionSign
 JSS(deletion_blockers_only);  // in: AccountObjects
 JSS(delivered_amount);        // out: insertDeliveredAmount
@@ -253,6 +257,8 @@ JSS(dir_root);                // out: DirectoryEntryIterator
 JSS(discounted_fee);          // out: amm_info
 JSS(domain);                  // out: ValidatorInfo, Manifest
 JSS(drops);                   // out: TxQ
+JSS(due_before);              // in: LoansDue
+JSS(due_date);                // out: LoanInfo, LoansDue
 JSS(duration_us);             // out: NetworkOPs
 JSS(effective);               // out: ValidatorList
                               // in: UNL
@@ -282,6 +288,7 @@ JSS(fee_base);                // out: NetworkOPs
 JSS(fee_div_max);             // in: TransactionSign
 JSS(fee_level);               // out: AccountInfo
 JSS(fee_mult_max);            // in: TransactionSign
+JSS(fee_paid);                // out: LoanInfo
 JSS(fee_ref);                 // out: NetworkOPs, DEPRECATED
 JSS(fetch_pack);              // out: NetworkOPs
 JSS(FIELDS);                  // out: RPC server_definitions
@@ -298,6 +305,7 @@ JSS(deep_freeze);                  // out: AccountLines
 JSS(deep_freeze_peer);             // out: AccountLines
 JSS(frozen_balances);         // out: GatewayBalances
 JSS(full);                    // in: LedgerClearer, handlers/Ledger
+JSS(full_payment);            // out: LoanInfo
 JSS(full_reply);              // out: PathFind
 JSS(fullbelow_size);          // out: GetCounts
 JSS(git);                     // out: server_info
@@ -325,6 +333,13 @@ JSS(index);                   // in: LedgerEntry
                               //      LedgerEntry, TxHistory, LedgerData
 JSS(info);                    // out: ServerInfo, ConsensusInfo, FetchInfo
 JSS(initial_sync_duration_us);
+JSS(innernode_allocs);        // out: GetCounts
+JSS(innernode_arena_size);    // out: GetCounts
+JSS(innernode_arena_used);    // out: GetCounts
+JSS(innernode_frees);         // out: GetCounts
+JSS(interest_due);            // out: LoanInfo
+JSS(interest_outstanding);    // out: LoanInfo
+JSS(interest_paid);           // out: LoanInfo
 JSS(internal_command);        // in: Internal
 JSS(invalid_API_version);     // out: Many, when a request has an invalid
                               //      version
@@ -354,6 +369,7 @@ JSS(last_close);              // out: NetworkOPs
 JSS(last_refresh_time);       // out: ValidatorSite
 JSS(last_refresh_status);     // out: ValidatorSite
 JSS(last_refresh_message);    // out: ValidatorSite
+JSS(late);                    // out: LoanInfo, LoansDue
 JSS(ledger);                  // in: NetworkOPs, LedgerCleaner,
                               //     RPCHelpers
                               // out: NetworkOPs, PeerImp
@@ -394,8 +410,11 @@ JSS(load_factor_local);       // out: NetworkOPs
 JSS(load_factor_net);         // out: NetworkOPs
 JSS(load_factor_server);      // out: NetworkOPs
 JSS(load_fee);                // out: LoadFeeTrackImp, NetworkOPs
-JSS(loan_broker_id);          // in: LedgerEntry
+JSS(loan_broker_id);          // in: LedgerEntry, LoansDue
+JSS(loan_id);                 // in: LoanInfo; out: LoansDue
 JSS(loan_seq);                // in: LedgerEntry
+JSS(loan_state);              // out: LoanInfo
+JSS(loans);                   // out: LoansDue
 JSS(local);                   // out: resource/Logic.h
 JSS(local_txs);               // out: GetCounts
 JSS(local_static_keys);       // out: ValidatorList
@@ -405,6 +424,8 @@ JSS(lowest_sequence);         // out: AccountInfo
 JSS(lowest_ticket);           // out: AccountInfo
 JSS(lp_token);                // out: amm_info
 JSS(majority);                // out: RPC feature
+JSS(management_fee_outstanding);
+                              // out: LoanInfo
 JSS(manifest);                // out: ValidatorInfo, Manifest
 JSS(marker);                  // in/out: AccountTx, AccountOffers,
                               //         AccountLines, AccountObjects,
@@ -442,6 +463,7 @@ JSS(needed_state_hashes);     // out: InboundLedger
 JSS(needed_transaction_hashes);  // out: InboundLedger
 JSS(network_id);              // out: NetworkOPs
 JSS(network_ledger);          // out: NetworkOPs
+JSS(next_payment);            // out: LoanInfo
 JSS(next_refresh_time);       // out: ValidatorSite
 JSS(nft_id);                  // in: nft_sell_offers, nft_buy_offers
 JSS(nft_offer_index);         // out nft_buy_offers, nft_sell_offers
@@ -460,7 +482,7 @@ JSS(node_reads_hit);          // out: GetCounts
 JSS(node_reads_total);        // out: GetCounts
 JSS(node_reads_duration_us);  // out: GetCounts
 JSS(node_size);               // out: server_info
-JSS(nodes);                   // out: VaultInfo
+JSS(nodes);                   // out: VaultInfo, LedgerSnapshot
 JSS(nodestore);               // out: GetCounts
 JSS(node_writes);             // out: GetCounts
 JSS(node_written_bytes);      // out: GetCounts
@@ -503,6 +525,8 @@ JSS(ports);                   // out: NetworkOPs
 JSS(previous);                // out: Reservations
 JSS(previous_ledger);         // out: LedgerPropose
 JSS(price);                   // out: amm_info, AuctionSlot
+JSS(principal_outstanding);   // out: LoanInfo
+JSS(principal_paid);          // out: LoanInfo
 JSS(proof);                   // in: BookOffers
 JSS(propose_seq);             // out: LedgerPropose
 JSS(proposers);               // out: NetworkOPs, LedgerConsensus
@@ -582,6 +606,7 @@ JSS(signing_time);            // out: NetworkOPs
 JSS(signer_lists);            // in/out: AccountInfo
 JSS(size);                    // out: get_aggregate_price
 JSS(snapshot);                // in: Subscribe
+                              // out: LedgerSnapshot
 JSS(source_account);          // in: PathRequest, RipplePathFind
 JSS(source_amount);           // in: PathRequest, RipplePathFind
 JSS(source_currencies);       // in: PathRequest, RipplePathFind
@@ -625,6 +650,9 @@ JSS(total);                   // out: counters
 JSS(total_bytes_recv);        // out: Peers
 JSS(total_bytes_sent);        // out: Peers
 JSS(total_coins);             // out: LedgerToJson
+JSS(total_due);               // out: LoanInfo
+JSS(total_value_outstanding); // out: LoanInfo
+JSS(total_writes);            // out: Peers
 JSS(trading_fee);             // out: amm_info
 JSS(transTreeHash);           // out: ledger/Ledger.cpp
 JSS(transaction);             // in: Tx
@@ -667,6 +695,8 @@ JSS(txr_selected_cnt);        // out: selected peers count
 JSS(txr_suppressed_cnt);      // out: suppressed peers count
 JSS(txr_not_enabled_cnt);     // out: peers with tx reduce-relay disabled count
 JSS(txr_missing_tx_freq);     // out: missing tx frequency average
+JSS(txr_batch_sz);            // out: relayed tx batch size average
+JSS(txr_batch_delay_us);      // out: relayed tx batch latency average
 JSS(txs);                     // out: TxHistory
 JSS(type);                    // in: AccountObjects
                               // out: NetworkOPs, RPC server_definitions
@@ -699,6 +729,7 @@ JSS(validations);               // out: AmendmentTableImpl
 JSS(validator_list_threshold);  // out: ValidatorList
 JSS(validator_sites);           // out: ValidatorSites
 JSS(value);                     // out: STAmount
+JSS(value_change);              // out: LoanInfo
 JSS(vault_id);                  // in: VaultInfo
 JSS(version);                   // out: RPCVersion
 JSS(vetoed);                    // out: AmendmentTableImpl
@@ -21,6 +21,8 @@
 #include <xrpl/beast/utility/instrumentation.h>
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
@@ -88,15 +90,26 @@ public:
     unsigned
     pop() noexcept;
 
+    // Record digits that were discarded all at once, instead of being pushed
+    // one at a time. rem is the value of the discarded digits, and half is
+    // one half of the place value of the least significant kept digit.
+    // Must only be called on an empty Guard, and pop() must not be called
+    // afterwards.
+    void
+    set(std::uint64_t rem, std::uint64_t half) noexcept;
+
     // Indicate round direction:  1 is up, -1 is down, 0 is even
     // This enables the client to round towards nearest, and on
     // tie, round towards even.
     int
     round() noexcept;
 
-    // Modify the result to the correctly rounded value
+    // Modify the result to the correctly rounded value. location() names
+    // the operation for the exception thrown on overflow, and is only
+    // called then, so no message is built on the common path.
+    template <class Location>
     void
-    doRoundUp(rep& mantissa, int& exponent, std::string location);
+    doRoundUp(rep& mantissa, int& exponent, Location const& location);
 
     // Modify the result to the correctly rounded value
     void
@@ -141,6 +154,23 @@ Number::Guard::pop() noexcept
     return d;
 }
 
+inline void
+Number::Guard::set(std::uint64_t rem, std::uint64_t half) noexcept
+{
+    // round() only depends on whether the discarded digits are zero, and how
+    // they compare to one half (0x5000'0000'0000'0000), so store a canonical
+    // value with the same properties.
+    if (rem == 0)
+        digits_ = 0;
+    else if (rem < half)
+        digits_ = 0x1000'0000'0000'0000;
+    else if (rem == half)
+        digits_ = 0x5000'0000'0000'0000;
+    else
+        digits_ = 0x6000'0000'0000'0000;
+    xbit_ = 0;
+}
+
 // Returns:
 //     -1 if Guard is less than half
 //      0 if Guard is exactly half
@@ -182,8 +212,12 @@ Number::Guard::round() noexcept
     return 0;
 }
 
+template <class Location>
 void
-Number::Guard::doRoundUp(rep& mantissa, int& exponent, std::string location)
+Number::Guard::doRoundUp(
+    rep& mantissa,
+    int& exponent,
+    Location const& location)
 {
     auto r = round();
     if (r == 1 || (r == 0 && (mantissa & 1) == 1))
@@ -201,7 +235,7 @@ Number::Guard::doRoundUp(rep& mantissa, int& exponent, std::string location)
         exponent = Number{}.exponent_;
     }
     if (exponent > maxExponent)
-        throw std::overflow_error(location);
+        throw std::overflow_error(location());
 }
 
 void
@@ -237,6 +271,89 @@ Number::Guard::doRound(rep& drops)
         drops = -drops;
 }
 
+// Fixed width integer helpers
+
+// 10^0 through 10^19, every power of 10 that fits in a std::uint64_t
+static constexpr std::array<std::uint64_t, 20> powersOfTen = []() {
+    std::array<std::uint64_t, 20> result{};
+    std::uint64_t p = 1;
+    for (auto& r : result)
+    {
+        r = p;
+        p *= 10;
+    }
+    return result;
+}();
+
+// The mantissa of a product of two normalized mantissas is always less than
+// 10^32. productLimits[i] is 10^(17 + i), the smallest product that needs
+// 2 + i digits discarded to fit in a normalized mantissa.
+static uint128_t const productLimits[15] = {
+    uint128_t(powersOfTen[17]),
+    uint128_t(powersOfTen[18]),
+    uint128_t(powersOfTen[19]),
+    uint128_t(powersOfTen[19]) * powersOfTen[1],
+    uint128_t(powersOfTen[19]) * powersOfTen[2],
+    uint128_t(powersOfTen[19]) * powersOfTen[3],
+    uint128_t(powersOfTen[19]) * powersOfTen[4],
+    uint128_t(powersOfTen[19]) * powersOfTen[5],
+    uint128_t(powersOfTen[19]) * powersOfTen[6],
+    uint128_t(powersOfTen[19]) * powersOfTen[7],
+    uint128_t(powersOfTen[19]) * powersOfTen[8],
+    uint128_t(powersOfTen[19]) * powersOfTen[9],
+    uint128_t(powersOfTen[19]) * powersOfTen[10],
+    uint128_t(powersOfTen[19]) * powersOfTen[11],
+    uint128_t(powersOfTen[19]) * powersOfTen[12],
+};
+static uint128_t const productMax =
+    uint128_t(powersOfTen[19]) * powersOfTen[13];
+
+// Returns the number of decimal digits in u, which is at least 1
+static inline int
+countDigits(std::uint64_t u) noexcept
+{
+    // Counting the powers of 10 that do not exceed u is branch free
+    int n = 1;
+    for (std::size_t i = 1; i < powersOfTen.size(); ++i)
+        n += u >= powersOfTen[i];
+    return n;
+}
+
+// Returns the number of least significant digits that must be discarded
+// to reduce u to at most Number::maxMantissa. Requires
+// Number::maxMantissa < u < 10^32.
+static inline int
+excessDigits(uint128_t const& u) noexcept
+{
+    int n = 1;
+    for (auto const& limit : productLimits)
+        n += u >= limit;
+    return n;
+}
+
+// Returns n / d, and sets r to n % d. The quotient is truncated to 64 bits,
+// which is exact when it fits.
+static inline std::uint64_t
+divide(uint128_t const& n, std::uint64_t d, std::uint64_t& r) noexcept
+{
+#if defined(__x86_64__) && !defined(_MSC_VER)
+    // A single 128 by 64 bit hardware division, which is much cheaper than the
+    // general 128 by 128 bit division. Only valid when the quotient fits in
+    // 64 bits, which is always the case for normalized operands.
+    auto const hi = static_cast<std::uint64_t>(n >> 64);
+    if (hi < d)
+    {
+        std::uint64_t q;
+        __asm__("divq %4"
+                : "=a"(q), "=d"(r)
+                : "a"(static_cast<std::uint64_t>(n)), "d"(hi), "rm"(d));
+        return q;
+    }
+#endif
+    r = static_cast<std::uint64_t>(n % d);
+    return static_cast<std::uint64_t>(n / d);
+}
+
 // Number
 
 constexpr Number one{1000000000000000, -15, Number::unchecked{}};
@@ -253,21 +370,42 @@ Number::normalize()
     auto m = static_cast<std::make_unsigned_t<rep>>(mantissa_);
     if (negative)
         m = -m;
-    while ((m < minMantissa) && (exponent_ > minExponent))
+    if (m < minMantissa && exponent_ > minExponent)
     {
-        m *= 10;
-        --exponent_;
+        // Scale up in a single step, but not below the minimum exponent
+        int const k = std::min(16 - countDigits(m), exponent_ - minExponent);
+        m *= powersOfTen[k];
+        exponent_ -= k;
     }
     Guard g;
     if (negative)
         g.set_negative();
-    while (m > maxMantissa)
+    if (m > maxMantissa && m < powersOfTen[18])
     {
-        if (exponent_ >= maxExponent)
+        // One or two excess digits is the common case (construction, sums and
+        // quotients), and dividing by a constant is cheaper than dividing by a
+        // power of ten looked up at run time.
+        do
+        {
+            if (exponent_ >= maxExponent)
+                throw std::overflow_error("Number::normalize 1");
+            g.push(m % 10);
+            m /= 10;
+            ++exponent_;
+        } while (m > maxMantissa);
+    }
+    else if (m > maxMantissa)
+    {
+        // Scale down in a single step. Digits are discarded with the exponent
+        // at exponent_ through exponent_ + k - 1, and none of those may reach
+        // the maximum exponent.
+        int const k = countDigits(m) - 16;
+        if (exponent_ >= maxExponent - (k - 1))
             throw std::overflow_error("Number::normalize 1");
-        g.push(m % 10);
-        m /= 10;
-        ++exponent_;
+        auto const p = powersOfTen[k];
+        g.set(m % p, p / 2);
+        m /= p;
+        exponent_ += k;
     }
     mantissa_ = m;
     if ((exponent_ < minExponent) || (mantissa_ < minMantissa))
@@ -276,7 +414,8 @@ Number::normalize()
         return;
     }
 
-    g.doRoundUp(mantissa_, exponent_, "Number::normalize 2");
+    g.doRoundUp(
+        mantissa_, exponent_, [] { return "Number::normalize 2"; });
 
     if (negative)
         mantissa_ = -mantissa_;
@@ -348,7 +487,7 @@ Number::operator+=(Number const& y)
             xm /= 10;
             ++xe;
         }
-        g.doRoundUp(xm, xe, "Number::addition overflow");
+        g.doRoundUp(xm, xe, [] { return "Number::addition overflow"; });
     }
     else
     {
@@ -438,6 +577,17 @@ Number::operator*=(Number const& y)
     Guard g;
     if (zn == -1)
         g.set_negative();
+    if (zm > maxMantissa && zm < productMax)
+    {
+        // Discard all the excess digits with a single division
+        int const k = excessDigits(zm);
+        auto const p = powersOfTen[k];
+        std::uint64_t rem;
+        zm = divide(zm, p, rem);
+        g.set(rem, p / 2);
+        ze += k;
+    }
+    // Only reachable if an operand is not normalized
     while (zm > maxMantissa)
     {
         // The following is optimization for:
@@ -448,10 +598,10 @@ Number::operator*=(Number const& y)
     }
     xm = static_cast<rep>(zm);
     xe = ze;
-    g.doRoundUp(
-        xm,
-        xe,
-        "Number::multiplication overflow : exponent is " + std::to_string(xe));
+    g.doRoundUp(xm, xe, [xe] {
+        return "Number::multiplication overflow : exponent is " +
+            std::to_string(xe);
+    });
     mantissa_ = xm * zn;
     exponent_ = xe;
     XRPL_ASSERT(
@@ -486,7 +636,12 @@ Number::operator/=(Number const& y)
     // Shift by 10^17 gives greatest precision while not overflowing uint128_t
     // or the cast back to int64_t
     uint128_t const f = 100'000'000'000'000'000;
-    mantissa_ = static_cast<std::int64_t>(uint128_t(nm) * f / uint128_t(dm));
+    auto const n = uint128_t(nm) * f;
+    auto const d = uint128_t(dm);
+    std::uint64_t rem;
+    mantissa_ = static_cast<std::int64_t>(
+        (d >> 64) == 0 ? divide(n, static_cast<std::uint64_t>(d), rem)
+                       : static_cast<std::uint64_t>(n / d));
     exponent_ = ne - de - 17;
     mantissa_ *= np * dp;
     normalize();
@@ -626,10 +781,17 @@ power(Number const& f, unsigned n)
         return one;
     if (n == 1)
         return f;
-    auto r = power(f, n / 2);
-    r *= r;
-    if (n % 2 != 0)
-        r *= f;
+    // Square and multiply, from the most significant bit of n down. This
+    // performs exactly the operations of the recursion
+    //     power(f, n) = power(f, n / 2)^2 * (n % 2 != 0 ? f : 1)
+    // in the same order, so the rounding of every step is unchanged.
+    auto r = f;
+    for (auto bit = std::bit_floor(n) >> 1; bit != 0; bit >>= 1)
+    {
+        r *= r;
+        if ((n & bit) != 0)
+            r *= f;
+    }
     return r;
 }
 
@@ -659,6 +821,9 @@ root(Number f, unsigned d)
         throw std::overflow_error("Number::root nan");
     if (f == Number{})
         return f;
+    // The curve fit and iteration below reduce to exactly those of root2
+    if (d == 2)
+        return root2(f);
 
     // Scale f into the range (0, 1) such that f's exponent is a multiple of d
     auto e = f.exponent() + 16;
@@ -694,13 +859,15 @@ root(Number f, unsigned d)
 
     //  Newton–Raphson iteration of f^(1/d) with initial guess r
     //  halt when r stops changing, checking for bouncing on the last iteration
+    Number const dm1{d - 1};
+    Number const dn{d};
     Number rm1{};
     Number rm2{};
     do
     {
         rm2 = rm1;
         rm1 = r;
-        r = (Number(d - 1) * r + f / power(r, d - 1)) / Number(d);
+        r = (dm1 * r + f / power(r, d - 1)) / dn;
     } while (r != rm1 && r != rm2);
 
     //  return r * 10^(e/d) to reverse scaling
@@ -723,22 +890,24 @@ root2(Number f)
         ++e;
     f = Number{f.mantissa(), f.exponent() - e};  // f /= 10^e;
 
-    // Quadratic least squares curve fit of f^(1/d) in the range [0, 1]
-    auto const D = 105;
-    auto const a0 = 18;
-    auto const a1 = 144;
-    auto const a2 = -60;
-    Number r = ((Number{a2} * f + Number{a1}) * f + Number{a0}) / Number{D};
+    // Quadratic least squares curve fit of f^(1/d) in the range [0, 1].
+    // The coefficients are 105, 18, 144 and -60, already normalized.
+    constexpr Number D{1050000000000000, -13, Number::unchecked{}};
+    constexpr Number a0{1800000000000000, -14, Number::unchecked{}};
+    constexpr Number a1{1440000000000000, -13, Number::unchecked{}};
+    constexpr Number a2{-6000000000000000, -14, Number::unchecked{}};
+    Number r = ((a2 * f + a1) * f + a0) / D;
 
     //  Newton–Raphson iteration of f^(1/2) with initial guess r
     //  halt when r stops changing, checking for bouncing on the last iteration
+    constexpr Number two{2000000000000000, -15, Number::unchecked{}};
     Number rm1{};
     Number rm2{};
     do
     {
         rm2 = rm1;
         rm1 = r;
-        r = (r + f / r) / Number(2);
+        r = (r + f / r) / two;
     } while (r != rm1 && r != rm2);
 
     //  return r * 10^(e/2) to reverse scaling
@@ -3466,67 +3466,84 @@ rippleCredit(
         saAmount.asset().value());
 }
 
+VaultConversion::VaultConversion(SLE const& vault, SLE const& issuance)
+    : asset(vault.at(sfAsset))
+    , share(vault.at(sfShareMPTID))
+    , scale(vault.at(sfScale))
+    , assetsTotal(vault.at(sfAssetsTotal))
+    , lossUnrealized(vault.at(sfLossUnrealized))
+    , sharesTotal(issuance.at(sfOutstandingAmount))
+{
+}
+
 [[nodiscard]] std::optional<STAmount>
-assetsToSharesDeposit(
-    std::shared_ptr<SLE const> const& vault,
-    std::shared_ptr<SLE const> const& issuance,
-    STAmount const& assets)
+assetsToSharesDeposit(VaultConversion const& vault, STAmount const& assets)
 {
     XRPL_ASSERT(
         !assets.negative(),
         "ripple::assetsToSharesDeposit : non-negative assets");
     XRPL_ASSERT(
-        assets.asset() == vault->at(sfAsset),
+        assets.asset() == vault.asset,
         "ripple::assetsToSharesDeposit : assets and vault match");
-    if (assets.negative() || assets.asset() != vault->at(sfAsset))
+    if (assets.negative() || assets.asset() != vault.asset)
         return std::nullopt;  // LCOV_EXCL_LINE
 
-    Number const assetTotal = vault->at(sfAssetsTotal);
-    STAmount shares{vault->at(sfShareMPTID)};
-    if (assetTotal == 0)
+    STAmount shares{vault.share};
+    if (vault.assetsTotal == 0)
         return STAmount{
             shares.asset(),
-            Number(assets.mantissa(), assets.exponent() + vault->at(sfScale))
+            Number(assets.mantissa(), assets.exponent() + vault.scale)
                 .truncate()};
 
-    Number const shareTotal = issuance->at(sfOutstandingAmount);
-    shares = (shareTotal * (assets / assetTotal)).truncate();
+    shares = (vault.sharesTotal * (assets / vault.assetsTotal)).truncate();
     return shares;
 }
 
 [[nodiscard]] std::optional<STAmount>
-sharesToAssetsDeposit(
+assetsToSharesDeposit(
     std::shared_ptr<SLE const> const& vault,
     std::shared_ptr<SLE const> const& issuance,
-    STAmount const& shares)
+    STAmount const& assets)
+{
+    return assetsToSharesDeposit(VaultConversion{*vault, *issuance}, assets);
+}
+
+[[nodiscard]] std::optional<STAmount>
+sharesToAssetsDeposit(VaultConversion const& vault, STAmount const& shares)
 {
     XRPL_ASSERT(
         !shares.negative(),
         "ripple::sharesToAssetsDeposit : non-negative shares");
     XRPL_ASSERT(
-        shares.asset() == vault->at(sfShareMPTID),
+        shares.asset() == vault.share,
         "ripple::sharesToAssetsDeposit : shares and vault match");
-    if (shares.negative() || shares.asset() != vault->at(sfShareMPTID))
+    if (shares.negative() || shares.asset() != vault.share)
         return std::nullopt;  // LCOV_EXCL_LINE
 
-    Number const assetTotal = vault->at(sfAssetsTotal);
-    STAmount assets{vault->at(sfAsset)};
-    if (assetTotal == 0)
+    STAmount assets{vault.asset};
+    if (vault.assetsTotal == 0)
         return STAmount{
             assets.asset(),
             shares.mantissa(),
-            shares.exponent() - vault->at(sfScale),
+            shares.exponent() - vault.scale,
             false};
 
-    Number const shareTotal = issuance->at(sfOutstandingAmount);
-    assets = assetTotal * (shares / shareTotal);
+    assets = vault.assetsTotal * (shares / vault.sharesTotal);
     return assets;
 }
 
 [[nodiscard]] std::optional<STAmount>
-assetsToSharesWithdraw(
+sharesToAssetsDeposit(
     std::shared_ptr<SLE const> const& vault,
     std::shared_ptr<SLE const> const& issuance,
+    STAmount const& shares)
+{
+    return sharesToAssetsDeposit(VaultConversion{*vault, *issuance}, shares);
+}
+
+[[nodiscard]] std::optional<STAmount>
+assetsToSharesWithdraw(
+    VaultConversion const& vault,
     STAmount const& assets,
     TruncateShares truncate)
 {
@@ -3534,18 +3551,17 @@ assetsToSharesWithdraw(
         !assets.negative(),
         "ripple::assetsToSharesDeposit : non-negative assets");
     XRPL_ASSERT(
-        assets.asset() == vault->at(sfAsset),
+        assets.asset() == vault.asset,
         "ripple::assetsToSharesWithdraw : assets and vault match");
-    if (assets.negative() || assets.asset() != vault->at(sfAsset))
+    if (assets.negative() || assets.asset() != vault.asset)
         return std::nullopt;  // LCOV_EXCL_LINE
 
-    Number assetTotal = vault->at(sfAssetsTotal);
-    assetTotal -= vault->at(sfLossUnrealized);
-    STAmount shares{vault->at(sfShareMPTID)};
+    Number assetTotal = vault.assetsTotal;
+    assetTotal -= vault.lossUnrealized;
+    STAmount shares{vault.share};
     if (assetTotal == 0)
         return shares;
-    Number const shareTotal = issuance->at(sfOutstandingAmount);
-    Number result = shareTotal * (assets / assetTotal);
+    Number result = vault.sharesTotal * (assets / assetTotal);
     if (truncate == TruncateShares::yes)
         result = result.truncate();
     shares = result;
@@ -3553,30 +3569,46 @@ assetsToSharesWithdraw(
 }
 
 [[nodiscard]] std::optional<STAmount>
-sharesToAssetsWithdraw(
+assetsToSharesWithdraw(
     std::shared_ptr<SLE const> const& vault,
     std::shared_ptr<SLE const> const& issuance,
-    STAmount const& shares)
+    STAmount const& assets,
+    TruncateShares truncate)
+{
+    return assetsToSharesWithdraw(
+        VaultConversion{*vault, *issuance}, assets, truncate);
+}
+
+[[nodiscard]] std::optional<STAmount>
+sharesToAssetsWithdraw(VaultConversion const& vault, STAmount const& shares)
 {
     XRPL_ASSERT(
         !shares.negative(),
         "ripple::sharesToAssetsDeposit : non-negative shares");
     XRPL_ASSERT(
-        shares.asset() == vault->at(sfShareMPTID),
+        shares.asset() == vault.share,
         "ripple::sharesToAssetsWithdraw : shares and vault match");
-    if (shares.negative() || shares.asset() != vault->at(sfShareMPTID))
+    if (shares.negative() || shares.asset() != vault.share)
         return std::nullopt;  // LCOV_EXCL_LINE
 
-    Number assetTotal = vault->at(sfAssetsTotal);
-    assetTotal -= vault->at(sfLossUnrealized);
-    STAmount assets{vault->at(sfAsset)};
+    Number assetTotal = vault.assetsTotal;
+    assetTotal -= vault.lossUnrealized;
+    STAmount assets{vault.asset};
     if (assetTotal == 0)
         return assets;
-    Number const shareTotal = issuance->at(sfOutstandingAmount);
-    assets = assetTotal * (shares / shareTotal);
+    assets = assetTotal * (shares / vault.sharesTotal);
     return assets;
 }
 
+[[nodiscard]] std::optional<STAmount>
+sharesToAssetsWithdraw(
+    std::shared_ptr<SLE const> const& vault,
+    std::shared_ptr<SLE const> const& issuance,
+    STAmount const& shares)
+{
+    return sharesToAssetsWithdraw(VaultConversion{*vault, *issuance}, shares);
+}
+
 TER
 rippleLockEscrowMPT(
     ApplyView& view,
@@ -20,6 +20,7 @@
 #include <test/jtx.h>
 #include <test/jtx/AMM.h>
 #include <test/jtx/Env.h>
+#include <test/jtx/envconfig.h>
 
 #include <xrpld/app/tx/apply.h>
 #include <xrpld/app/tx/detail/ApplyContext.h>
@@ -3846,6 +3847,130 @@ class Invariants_test : public beast::unit_test::suite
             precloseMpt);
     }
 
+    void
+    testParallelChecks()
+    {
+        using namespace test::jtx;
+        testcase << "parallel checks";
+
+        // Check the invariants of every transaction in parallel
+        Env env{*this, envconfig([](std::unique_ptr<Config> cfg) {
+                    cfg->FORCE_MULTI_THREAD = true;
+                    cfg->PARALLEL_INVARIANT_WORKERS = 4;
+                    cfg->PARALLEL_INVARIANT_MIN_ENTRIES = 1;
+                    return cfg;
+                })};
+
+        Account const A1{"A1"};
+        Account const A2{"A2"};
+        Account const gw{"gw"};
+        auto const USD = gw["USD"];
+        env.fund(XRP(10'000), A1, A2, gw);
+        env.trust(USD(1'000), A1, A2);
+        env(pay(gw, A1, USD(500)));
+        env(offer(A1, XRP(100), USD(100)));
+        env(offer(A2, USD(100), XRP(100)));
+        env.close();
+        env.require(balance(A2, USD(100)));
+
+        // A transaction which breaks an invariant still fails
+        OpenView ov{*env.current()};
+        test::StreamSink sink{beast::severities::kWarning};
+        beast::Journal jlog{sink};
+        ApplyContext ac{
+            env.app(),
+            ov,
+            STTx{ttACCOUNT_SET, [](STObject&) {}},
+            tesSUCCESS,
+            env.current()->fees().base,
+            tapNONE,
+            jlog};
+
+        auto const sle = ac.view().peek(keylet::account(A1.id()));
+        if (!BEAST_EXPECT(sle))
+            return;
+        sle->setFieldAmount(
+            sfBalance, sle->getFieldAmount(sfBalance) + STAmount{500});
+        ac.view().update(sle);
+
+        TER ter = ac.checkInvariants(tesSUCCESS, XRPAmount{});
+        BEAST_EXPECT(ter == tecINVARIANT_FAILED);
+        ter = ac.checkInvariants(ter, XRPAmount{});
+        BEAST_EXPECT(ter == tefINVARIANT_FAILED);
+        BEAST_EXPECT(
+            sink.messages().str().find("XRP net change was positive: 500") !=
+            std::string::npos);
+
+        // An amendment gated check is only enforced with the amendment, and
+        // the state of the calling thread is intact afterwards
+        for (bool const withFix : {true, false})
+        {
+            FeatureBitset features = testable_amendments();
+            if (!withFix)
+                features -= fixAMMv1_3;
+            Env env{
+                *this,
+                envconfig([](std::unique_ptr<Config> cfg) {
+                    cfg->FORCE_MULTI_THREAD = true;
+                    cfg->PARALLEL_INVARIANT_WORKERS = 4;
+                    cfg->PARALLEL_INVARIANT_MIN_ENTRIES = 1;
+                    return cfg;
+                }),
+                features};
+            env.fund(XRP(10'000), A1, gw);
+            env.trust(USD(1'000), A1);
+            env(pay(gw, A1, USD(500)));
+            env.close();
+            AMM const amm(env, A1, XRP(100), USD(50));
+
+            OpenView ov{*env.current()};
+            test::StreamSink sink{beast::severities::kWarning};
+            beast::Journal jlog{sink};
+            ApplyContext ac{
+                env.app(),
+                ov,
+                STTx{
+                    ttAMM_DEPOSIT,
+                    [&](STObject& tx) {
+                        tx.setFieldIssue(sfAsset, STIssue{sfAsset, xrpIssue()});
+                        tx.setFieldIssue(
+                            sfAsset2, STIssue{sfAsset2, USD.issue()});
+                    }},
+                tesSUCCESS,
+                env.current()->fees().base,
+                tapNONE,
+                jlog};
+
+            // Mint LP tokens beyond the mean of the pool product
+            auto const sleAMM =
+                ac.view().peek(keylet::amm(xrpIssue(), USD.issue()));
+            if (!BEAST_EXPECT(sleAMM))
+                return;
+            sleAMM->setFieldAmount(
+                sfLPTokenBalance, STAmount{amm.lptIssue(), 1'000'000});
+            ac.view().update(sleAMM);
+
+            // Install the state Transactor::operator() installs
+            NumberSO const numberSO{ov.rules().enabled(fixUniversalNumber)};
+            CurrentTransactionRulesGuard const rulesGuard(ov.rules());
+            NumberRoundModeGuard const roundGuard(Number::upward);
+
+            TER const ter = ac.checkInvariants(tesSUCCESS, XRPAmount{});
+            BEAST_EXPECT(ter == (withFix ? tecINVARIANT_FAILED : tesSUCCESS));
+            BEAST_EXPECT(
+                sink.messages().str().find("invariant failed") !=
+                std::string::npos);
+
+            BEAST_EXPECT(Number::getround() == Number::upward);
+            BEAST_EXPECT(
+                getSTNumberSwitchover() ==
+                ov.rules().enabled(fixUniversalNumber));
+            BEAST_EXPECT(
+                getCurrentTransactionRules() &&
+                getCurrentTransactionRules()->enabled(fixAMMv1_3) == withFix);
+        }
+    }
+
 public:
     void
     run() override
@@ -3869,6 +3994,7 @@ public:
         testValidPseudoAccounts();
         testValidLoanBroker();
         testVault();
+        testParallelChecks();
     }
 };
 
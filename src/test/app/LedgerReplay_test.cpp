@@ -319,6 +319,10 @@ public:
     removeTxQueue(uint256 const&) override
     {
     }
+    void
+    addTxBatch(std::shared_ptr<protocol::TMTransaction const> const&) override
+    {
+    }
     bool
     txReduceRelayEnabled() const override
     {
@@ -1097,7 +1101,7 @@ struct LedgerReplayer_test : public beast::unit_test::suite
         testcase("handshake test");
         auto handshake = [&](bool client, bool server, bool expecting) -> bool {
             auto request =
-                ripple::makeRequest(true, false, client, false, false);
+                ripple::makeRequest(true, false, {}, client, false, false);
             http_request_type http_request;
             http_request.version(request.version());
             http_request.base() = request.base();
@@ -1118,6 +1122,7 @@ struct LedgerReplayer_test : public beast::unit_test::suite
                 uint256{1},
                 1,
                 {1, 0},
+                {},
                 serverEnv.app());
             auto const clientResult =
                 peerFeatureEnabled(http_resp, FEATURE_LEDGER_REPLAY, client);
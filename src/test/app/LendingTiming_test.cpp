@@ -0,0 +1,306 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <test/jtx.h>
+#include <test/jtx/envconfig.h>
+#include <test/jtx/vault.h>
+
+#include <xrpl/beast/unit_test.h>
+#include <xrpl/beast/xor_shift_engine.h>
+#include <xrpl/protocol/Feature.h>
+#include <xrpl/protocol/Indexes.h>
+#include <xrpl/protocol/TxFlags.h>
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace ripple {
+namespace test {
+
+// NOTE This is a rather naive benchmark of the lending protocol
+// transactors. It drives a mixed workload of loan and vault transactions
+// through jtx::Env, and reports latency percentiles for each transaction type
+// and the rate at which the ledgers close. The latencies include the jtx
+// overhead of building and signing each transaction, so they are most useful
+// to compare two builds on the same machine.
+
+class LendingTiming_test : public beast::unit_test::suite
+{
+    using clock = std::chrono::steady_clock;
+
+    FeatureBitset const all{
+        jtx::testable_amendments() | featureMPTokensV1 |
+        featureSingleAssetVault | featureLendingProtocol};
+
+    struct Workload
+    {
+        std::size_t brokers;
+        std::size_t loansPerBroker;
+        std::size_t ledgers;
+    };
+
+    struct Broker
+    {
+        jtx::Account lender;
+        uint256 vaultID;
+        uint256 brokerID;
+        std::vector<uint256> loans;
+    };
+
+    // Latencies of each type of transaction
+    std::map<std::string, std::vector<clock::duration>> samples_;
+
+    template <class... Args>
+    void
+    apply(jtx::Env& env, char const* name, Args&&... args)
+    {
+        auto const start = clock::now();
+        env(std::forward<Args>(args)...);
+        samples_[name].push_back(clock::now() - start);
+    }
+
+    void
+    report()
+    {
+        using namespace std::chrono;
+
+        auto const us = [](clock::duration d) {
+            return duration_cast<duration<double, std::micro>>(d).count();
+        };
+
+        for (auto& [name, latencies] : samples_)
+        {
+            std::sort(latencies.begin(), latencies.end());
+            auto const percentile = [&](double p) {
+                return us(latencies[static_cast<std::size_t>(
+                    p * static_cast<double>(latencies.size() - 1))]);
+            };
+            log << name << ": p50 " << percentile(0.5) << " us, p90 "
+                << percentile(0.9) << " us, p99 " << percentile(0.99)
+                << " us, max " << us(latencies.back()) << " us ("
+                << latencies.size() << " txs)" << std::endl;
+        }
+        samples_.clear();
+    }
+
+    Broker
+    createBroker(
+        jtx::Env& env,
+        jtx::PrettyAsset const& asset,
+        jtx::Account const& lender)
+    {
+        using namespace jtx;
+
+        Vault vault{env};
+        auto [tx, vaultKeylet] =
+            vault.create({.owner = lender, .asset = asset});
+        apply(env, "VaultCreate", tx);
+        env.close();
+
+        apply(
+            env,
+            "VaultDeposit",
+            vault.deposit(
+                {.depositor = lender,
+                 .id = vaultKeylet.key,
+                 .amount = asset(1'000'000)}));
+
+        auto const keylet = keylet::loanbroker(lender.id(), env.seq(lender));
+        apply(
+            env,
+            "LoanBrokerSet",
+            loanBroker::set(lender, vaultKeylet.key),
+            loanBroker::managementFeeRate(TenthBips16{100}),
+            loanBroker::coverRateMinimum(TenthBips32{10'000}),
+            loanBroker::coverRateLiquidation(TenthBips32{25'000}));
+        apply(
+            env,
+            "LoanBrokerCoverDeposit",
+            loanBroker::coverDeposit(lender, keylet.key, asset(100'000)));
+        env.close();
+
+        return {lender, vaultKeylet.key, keylet.key, {}};
+    }
+
+    void
+    testWorkload(Workload const& workload)
+    {
+        using namespace jtx;
+        using namespace std::chrono_literals;
+
+        testcase << workload.brokers << " brokers with "
+                 << workload.loansPerBroker << " loans each, "
+                 << workload.ledgers << " ledgers";
+
+        // Keep the open ledger fee from escalating, so every transaction is
+        // applied to the ledger it is submitted to
+        Env env{
+            *this,
+            envconfig([](std::unique_ptr<Config> cfg) {
+                cfg->section("transaction_queue")
+                    .set("minimum_txn_in_ledger_standalone", "100000");
+                return cfg;
+            }),
+            all};
+
+        Account const issuer{"issuer"};
+        Account const borrower{"borrower"};
+        PrettyAsset const asset = issuer["IOU"];
+
+        env.fund(XRP(10'000'000), issuer, borrower);
+        env.trust(asset(1'000'000'000), borrower);
+        env(pay(issuer, borrower, asset(100'000'000)));
+        env.close();
+
+        std::vector<Broker> brokers;
+        for (std::size_t i = 0; i < workload.brokers; ++i)
+        {
+            Account const lender{"lender" + std::to_string(i)};
+            env.fund(XRP(1'000'000), lender);
+            env.trust(asset(1'000'000'000), lender);
+            env(pay(issuer, lender, asset(100'000'000)));
+            env.close();
+            brokers.push_back(createBroker(env, asset, lender));
+        }
+
+        // Loans of different sizes and terms, each due well after the last
+        // ledger of the workload, so no payment is ever late
+        beast::xor_shift_engine gen{workload.brokers};
+        std::uniform_int_distribution<std::uint32_t> principal{100, 5'000};
+        std::uniform_int_distribution<std::uint32_t> rate{1'000, 20'000};
+        std::uniform_int_distribution<std::uint32_t> payments{12, 360};
+
+        for (auto& broker : brokers)
+        {
+            for (std::size_t i = 0; i < workload.loansPerBroker; ++i)
+            {
+                auto const loanSequence = env.le(keylet::loanbroker(
+                                                     broker.brokerID))
+                                              ->at(sfLoanSequence);
+                broker.loans.push_back(
+                    keylet::loan(broker.brokerID, loanSequence).key);
+                apply(
+                    env,
+                    "LoanSet",
+                    loan::set(borrower, broker.brokerID, principal(gen)),
+                    sig(sfCounterpartySignature, broker.lender),
+                    loan::interestRate(TenthBips32{rate(gen)}),
+                    loan::paymentTotal(payments(gen)),
+                    loan::paymentInterval(30 * 24 * 3600),
+                    fee(env.current()->fees().base * 2));
+            }
+            env.close();
+        }
+
+        // The mix of transactions applied to each loan in each ledger
+        std::discrete_distribution<int> action{70, 10, 10, 10};
+
+        auto const start = clock::now();
+        for (std::size_t ledger = 0; ledger < workload.ledgers; ++ledger)
+        {
+            for (auto const& broker : brokers)
+            {
+                Vault vault{env};
+                for (auto const& loanID : broker.loans)
+                {
+                    switch (action(gen))
+                    {
+                        case 0: {
+                            auto const loan = env.le(keylet::loan(loanID));
+                            if (loan->at(sfPaymentRemaining) == 0)
+                                break;
+                            // A little extra covers the rounding of the
+                            // payment, but not a second payment.
+                            Number const amount =
+                                loan->at(sfPeriodicPayment) * Number{1001, -3};
+                            apply(
+                                env,
+                                "LoanPay",
+                                loan::pay(
+                                    borrower,
+                                    loanID,
+                                    STAmount{asset.raw(), amount}));
+                            break;
+                        }
+                        case 1:
+                            apply(
+                                env,
+                                "LoanManage",
+                                loan::manage(
+                                    broker.lender, loanID, tfLoanImpair));
+                            apply(
+                                env,
+                                "LoanManage",
+                                loan::manage(
+                                    broker.lender, loanID, tfLoanUnimpair));
+                            break;
+                        case 2:
+                            apply(
+                                env,
+                                "VaultDeposit",
+                                vault.deposit(
+                                    {.depositor = broker.lender,
+                                     .id = broker.vaultID,
+                                     .amount = asset(100)}));
+                            break;
+                        case 3:
+                            apply(
+                                env,
+                                "VaultWithdraw",
+                                vault.withdraw(
+                                    {.depositor = broker.lender,
+                                     .id = broker.vaultID,
+                                     .amount = asset(100)}));
+                            break;
+                    }
+                }
+            }
+
+            auto const closeStart = clock::now();
+            env.close(env.now() + 60s);
+            samples_["close"].push_back(clock::now() - closeStart);
+        }
+        auto const elapsed =
+            std::chrono::duration_cast<std::chrono::duration<double>>(
+                clock::now() - start);
+
+        log << "ledgers: " << workload.ledgers / elapsed.count()
+            << " ledgers/s (" << workload.ledgers << " ledgers in "
+            << elapsed.count() << " s)" << std::endl;
+        report();
+        pass();
+    }
+
+public:
+    void
+    run() override
+    {
+        testWorkload({.brokers = 1, .loansPerBroker = 50, .ledgers = 20});
+        testWorkload({.brokers = 4, .loansPerBroker = 100, .ledgers = 20});
+    }
+};
+
+BEAST_DEFINE_TESTSUITE_MANUAL(LendingTiming, app, ripple);
+
+}  // namespace test
+}  // namespace ripple
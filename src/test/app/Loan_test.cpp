@@ -27,6 +27,8 @@
 #include <xrpl/beast/unit_test/suite.h>
 #include <xrpl/protocol/SField.h>
 
+#include <thread>
+
 namespace ripple {
 namespace test {
 
@@ -3560,6 +3562,199 @@ class Loan_test : public beast::unit_test::suite
         pass();
     }
 
+    void
+    testAmortizationTable()
+    {
+        // The amortization table used for multi-installment payments must
+        // produce exactly the same results as computing each installment from
+        // scratch.
+        testcase("Amortization table");
+
+        using namespace jtx;
+
+        Account const issuer{"issuer"};
+        std::array<std::pair<char const*, Asset>, 3> const assets{{
+            {"XRP", xrpIssue()},
+            {"IOU", issuer["IOU"].issue()},
+            {"MPT", makeMptID(1, issuer.id())},
+        }};
+
+        auto const samePayment = [](detail::PaymentComponents const& a,
+                                    detail::PaymentComponents const& b) {
+            return a.rawInterest == b.rawInterest &&
+                a.rawPrincipal == b.rawPrincipal &&
+                a.rawManagementFee == b.rawManagementFee &&
+                a.trackedValueDelta == b.trackedValueDelta &&
+                a.trackedPrincipalDelta == b.trackedPrincipalDelta &&
+                a.trackedManagementFeeDelta == b.trackedManagementFeeDelta &&
+                a.specialCase == b.specialCase;
+        };
+        auto const sameState = [](ripple::LoanState const& a,
+                                  ripple::LoanState const& b) {
+            return a.valueOutstanding == b.valueOutstanding &&
+                a.principalOutstanding == b.principalOutstanding &&
+                a.interestOutstanding == b.interestOutstanding &&
+                a.interestDue == b.interestDue &&
+                a.managementFeeDue == b.managementFeeDue;
+        };
+
+        // 30 days, in seconds
+        std::uint32_t const monthly = 30 * 24 * 60 * 60;
+        for (auto const& [label, asset] : assets)
+        {
+            for (std::uint32_t const payments : {12u, 24u, 60u, 120u, 360u})
+            {
+                for (std::uint32_t const percent : {0u, 1u, 12u, 100u})
+                {
+                    TenthBips32 const interestRate =
+                        percentageToTenthBips(percent);
+                    Number const principal = asset.integral()
+                        ? Number{250'000'000}
+                        : Number{2'500'123, -2};
+
+                    auto const props = computeLoanProperties(
+                        asset,
+                        principal,
+                        interestRate,
+                        monthly,
+                        payments,
+                        managementFeeRateParameter);
+                    auto const periodicRate =
+                        loanPeriodicRate(interestRate, monthly);
+
+                    detail::LoanAmortizationTable table{
+                        props.periodicPayment,
+                        periodicRate,
+                        managementFeeRateParameter};
+
+                    Number totalValue = props.totalValueOutstanding;
+                    Number principalOutstanding = roundToAsset(
+                        asset, principal, props.loanScale, Number::to_nearest);
+                    Number feeOutstanding = props.managementFeeOwedToBroker;
+                    std::uint32_t paymentRemaining = payments;
+
+                    bool tableMatches = true;
+                    bool componentsMatch = true;
+                    while (paymentRemaining > 0)
+                    {
+                        tableMatches = tableMatches &&
+                            sameState(
+                                table.rawState(paymentRemaining),
+                                calculateRawLoanState(
+                                    props.periodicPayment,
+                                    periodicRate,
+                                    paymentRemaining,
+                                    managementFeeRateParameter));
+
+                        auto const expected = detail::computePaymentComponents(
+                            asset,
+                            props.loanScale,
+                            totalValue,
+                            principalOutstanding,
+                            feeOutstanding,
+                            props.periodicPayment,
+                            periodicRate,
+                            paymentRemaining,
+                            managementFeeRateParameter);
+                        auto const actual = detail::computePaymentComponents(
+                            asset,
+                            props.loanScale,
+                            totalValue,
+                            principalOutstanding,
+                            feeOutstanding,
+                            paymentRemaining,
+                            table);
+                        componentsMatch =
+                            componentsMatch && samePayment(expected, actual);
+
+                        if (expected.specialCase ==
+                            detail::PaymentSpecialCase::final)
+                            break;
+                        totalValue -= expected.trackedValueDelta;
+                        principalOutstanding -= expected.trackedPrincipalDelta;
+                        feeOutstanding -= expected.trackedManagementFeeDelta;
+                        --paymentRemaining;
+                    }
+
+                    if (!BEAST_EXPECT(tableMatches && componentsMatch))
+                        log << label << " " << payments << " payments at "
+                            << percent << "%: amortization table mismatch"
+                            << std::endl;
+                }
+            }
+        }
+    }
+
+    void
+    testLoanRateCache()
+    {
+        testcase("Loan rate cache");
+
+        using namespace jtx;
+        Env env(*this, all);
+
+        TenthBips32 const interestRate = percentageToTenthBips(12);
+        std::uint32_t const interval = 30 * 24 * 60 * 60;
+        auto const computeProperties = [&]() {
+            return computeLoanProperties(
+                xrpIssue(),
+                Number{250'000'000},
+                interestRate,
+                interval,
+                360,
+                managementFeeRateParameter);
+        };
+        auto const sameProperties = [](LoanProperties const& a,
+                                       LoanProperties const& b) {
+            return a.periodicPayment == b.periodicPayment &&
+                a.totalValueOutstanding == b.totalValueOutstanding &&
+                a.managementFeeOwedToBroker == b.managementFeeOwedToBroker &&
+                a.loanScale == b.loanScale &&
+                a.firstPaymentPrincipal == b.firstPaymentPrincipal;
+        };
+
+        BEAST_EXPECT(LoanRateCache::active() == nullptr);
+        auto const expectedRate = loanPeriodicRate(interestRate, interval);
+        auto const expected = computeProperties();
+
+        {
+            LoanRateCache::Scope const scope{*env.current()};
+            auto const cache = LoanRateCache::active();
+            if (!BEAST_EXPECT(cache))
+                return;
+
+            // The first pass fills the cache, the second is served from it
+            BEAST_EXPECT(
+                loanPeriodicRate(interestRate, interval) == expectedRate);
+            BEAST_EXPECT(sameProperties(computeProperties(), expected));
+            auto const size = cache->size();
+            BEAST_EXPECT(size >= 2);
+            BEAST_EXPECT(
+                loanPeriodicRate(interestRate, interval) == expectedRate);
+            BEAST_EXPECT(sameProperties(computeProperties(), expected));
+            BEAST_EXPECT(cache->size() == size);
+
+            // The rounding mode is part of the key
+            {
+                NumberRoundModeGuard mg(Number::upward);
+                BEAST_EXPECT(
+                    loanPeriodicRate(interestRate, interval) ==
+                    detail::computePeriodicRate(interestRate, interval));
+            }
+            BEAST_EXPECT(cache->size() == size + 1);
+        }
+        BEAST_EXPECT(LoanRateCache::active() == nullptr);
+
+        // A new ledger starts with an empty cache
+        env.close();
+        {
+            LoanRateCache::Scope const scope{*env.current()};
+            auto const cache = LoanRateCache::active();
+            if (BEAST_EXPECT(cache))
+                BEAST_EXPECT(cache->size() == 0);
+        }
+    }
+
     void
     testIssuerLoan()
     {
@@ -4584,6 +4779,373 @@ class Loan_test : public beast::unit_test::suite
     }
 
 public:
+    void
+    testLoanInfoRPC()
+    {
+        testcase("loan_info and loan_broker_info RPC");
+
+        using namespace jtx;
+        Env env(*this, all);
+
+        Account const issuer{"issuer"};
+        Account const lender{"lender"};
+        Account const borrower{"borrower"};
+
+        env.fund(XRP(1'000'000), issuer, lender, borrower);
+        env.close();
+
+        PrettyAsset const iouAsset = issuer[iouCurrency];
+        env(trust(lender, iouAsset(100'000'000)));
+        env(trust(borrower, iouAsset(100'000'000)));
+        env(pay(issuer, lender, iouAsset(10'000'000)));
+        env(pay(issuer, borrower, iouAsset(100'000)));
+        env.close();
+
+        BrokerInfo broker{createVaultAndBroker(env, iouAsset, lender)};
+
+        using namespace loan;
+
+        auto const loanSequence =
+            env.le(keylet::loanbroker(broker.brokerID))->at(sfLoanSequence);
+        auto const loanKeylet = keylet::loan(broker.brokerID, loanSequence);
+
+        env(set(borrower, broker.brokerID, Number{1000}),
+            sig(sfCounterpartySignature, lender),
+            interestRate(TenthBips32(50'000)),
+            paymentTotal(12),
+            paymentInterval(600),
+            loanServiceFee(Number{1}),
+            fee(env.current()->fees().base * 2));
+        env.close();
+
+        auto loanInfo = [&](Json::Value params,
+                            std::string const& ledger = "current") {
+            params[jss::ledger_index] = ledger;
+            return env.rpc("json", "loan_info", to_string(params))
+                [jss::result];
+        };
+        auto loanInfoByID = [&](std::string const& ledger = "current") {
+            Json::Value params;
+            params[jss::loan_id] = to_string(loanKeylet.key);
+            return loanInfo(params, ledger);
+        };
+
+        {
+            // Both ways of naming the loan find the same object
+            auto const byID = loanInfoByID();
+            Json::Value params;
+            params[jss::loan_broker_id] = to_string(broker.brokerID);
+            params[jss::loan_seq] = loanSequence;
+            auto const bySeq = loanInfo(params);
+            BEAST_EXPECT(!byID.isMember(jss::error));
+            BEAST_EXPECT(
+                byID[jss::loan][jss::index] == to_string(loanKeylet.key));
+            BEAST_EXPECT(byID[jss::loan_state] == bySeq[jss::loan_state]);
+            BEAST_EXPECT(byID[jss::next_payment] == bySeq[jss::next_payment]);
+            BEAST_EXPECT(byID[jss::next_payment][jss::late] == false);
+            BEAST_EXPECT(
+                byID[jss::next_payment][jss::due_date] ==
+                byID[jss::loan][sfNextPaymentDueDate.jsonName]);
+            BEAST_EXPECT(byID.isMember(jss::full_payment));
+
+            // The command line form
+            auto const cli =
+                env.rpc("loan_info", to_string(loanKeylet.key), "current")
+                    [jss::result];
+            BEAST_EXPECT(cli[jss::loan_state] == byID[jss::loan_state]);
+        }
+
+        {
+            // Invalid requests
+            auto const expectError = [&](Json::Value const& result,
+                                         std::string const& error) {
+                BEAST_EXPECT(result[jss::error] == error);
+            };
+            expectError(loanInfo(Json::objectValue), "malformedRequest");
+
+            Json::Value params;
+            params[jss::loan_id] = "not a hex ID";
+            expectError(loanInfo(params), "malformedRequest");
+
+            params[jss::loan_id] = to_string(loanKeylet.key);
+            params[jss::loan_seq] = loanSequence;
+            expectError(loanInfo(params), "malformedRequest");
+
+            params.removeMember(jss::loan_id);
+            expectError(loanInfo(params), "malformedRequest");
+
+            params[jss::loan_broker_id] = to_string(broker.brokerID);
+            params[jss::loan_seq] = loanSequence + 1;
+            expectError(loanInfo(params), "entryNotFound");
+
+            Json::Value brokerParams;
+            brokerParams[jss::loan_broker_id] = to_string(loanKeylet.key);
+            expectError(
+                env.rpc("json", "loan_broker_info", to_string(brokerParams))
+                    [jss::result],
+                "entryNotFound");
+        }
+
+        {
+            // The amounts reported are exactly what LoanPay requires
+            auto const info = loanInfoByID();
+            Number const totalDue = amountFromString(
+                broker.asset.raw(),
+                info[jss::next_payment][jss::total_due].asString());
+            BEAST_EXPECT(totalDue > beast::zero);
+
+            env(pay(borrower,
+                    loanKeylet.key,
+                    STAmount{broker.asset, totalDue - Number{1, -2}}),
+                ter(tecINSUFFICIENT_PAYMENT));
+            env(pay(
+                borrower, loanKeylet.key, STAmount{broker.asset, totalDue}));
+            env.close();
+
+            auto const after = loanInfoByID();
+            BEAST_EXPECT(
+                after[jss::loan][sfPaymentRemaining.jsonName] ==
+                info[jss::loan][sfPaymentRemaining.jsonName].asUInt() - 1);
+        }
+
+        {
+            // Results for a closed ledger are repeatable
+            auto const first = loanInfoByID("validated");
+            auto const second = loanInfoByID("validated");
+            BEAST_EXPECT(!first.isMember(jss::error));
+            BEAST_EXPECT(first[jss::loan_state] == second[jss::loan_state]);
+            BEAST_EXPECT(
+                first[jss::next_payment] == second[jss::next_payment]);
+            BEAST_EXPECT(
+                first[jss::parent_close_time] ==
+                second[jss::parent_close_time]);
+        }
+
+        {
+            auto const brokerSle = env.le(keylet::loanbroker(broker.brokerID));
+            Json::Value params;
+            params[jss::owner] = lender.human();
+            params[jss::seq] = brokerSle->at(sfSequence);
+            auto const info =
+                env.rpc("json", "loan_broker_info", to_string(params))
+                    [jss::result];
+            BEAST_EXPECT(
+                info[jss::loan_broker][jss::index] ==
+                to_string(broker.brokerID));
+            BEAST_EXPECT(
+                info[jss::debt_total] ==
+                to_string(Number(brokerSle->at(sfDebtTotal))));
+            BEAST_EXPECT(
+                info[jss::cover_available] ==
+                to_string(Number(brokerSle->at(sfCoverAvailable))));
+            BEAST_EXPECT(info.isMember(jss::cover_minimum));
+            BEAST_EXPECT(info.isMember(jss::cover_ratio));
+        }
+
+        {
+            // A cached result is only found by the method of its type
+            Json::Value brokerParams;
+            brokerParams[jss::loan_broker_id] = to_string(broker.brokerID);
+            brokerParams[jss::ledger_index] = "validated";
+            auto const brokerInfo = env.rpc(
+                "json",
+                "loan_broker_info",
+                to_string(brokerParams))[jss::result];
+            BEAST_EXPECT(!brokerInfo.isMember(jss::error));
+            BEAST_EXPECT(!loanInfoByID("validated").isMember(jss::error));
+
+            Json::Value params;
+            params[jss::loan_id] = to_string(broker.brokerID);
+            BEAST_EXPECT(
+                loanInfo(params, "validated")[jss::error] == "entryNotFound");
+
+            brokerParams[jss::loan_broker_id] = to_string(loanKeylet.key);
+            BEAST_EXPECT(
+                env.rpc("json", "loan_broker_info", to_string(brokerParams))
+                    [jss::result][jss::error] == "entryNotFound");
+        }
+    }
+
+    void
+    testLoansDueRPC()
+    {
+        testcase("loans_due RPC");
+
+        using namespace jtx;
+        using namespace std::chrono_literals;
+        Env env(*this, all);
+
+        Account const issuer{"issuer"};
+        Account const lender{"lender"};
+        Account const borrower{"borrower"};
+
+        env.fund(XRP(1'000'000), issuer, lender, borrower);
+        env.close();
+
+        PrettyAsset const iouAsset = issuer[iouCurrency];
+        env(trust(lender, iouAsset(100'000'000)));
+        env(trust(borrower, iouAsset(100'000'000)));
+        env(pay(issuer, lender, iouAsset(10'000'000)));
+        env(pay(issuer, borrower, iouAsset(100'000)));
+        env.close();
+
+        BrokerInfo broker{createVaultAndBroker(env, iouAsset, lender)};
+
+        using namespace loan;
+
+        // Create the loans out of due date order
+        std::vector<uint256> loanIDs;
+        for (std::uint32_t const interval : {3600u, 600u, 1800u})
+        {
+            auto const loanSequence =
+                env.le(keylet::loanbroker(broker.brokerID))
+                    ->at(sfLoanSequence);
+            loanIDs.push_back(keylet::loan(broker.brokerID, loanSequence).key);
+            env(set(borrower, broker.brokerID, Number{1000}),
+                sig(sfCounterpartySignature, lender),
+                interestRate(TenthBips32(50'000)),
+                paymentTotal(12),
+                paymentInterval(interval),
+                fee(env.current()->fees().base * 2));
+            env.close();
+        }
+
+        auto loansDue = [&](Json::Value params) {
+            params[jss::loan_broker_id] = to_string(broker.brokerID);
+            return env.rpc("json", "loans_due", to_string(params))
+                [jss::result];
+        };
+
+        // Ledgers are published asynchronously, and the index follows the
+        // published ledgers.
+        auto const close = [&](auto&&... args) {
+            env.close(args...);
+            for (int i = 0; i < 100; ++i)
+            {
+                if (loansDue(Json::objectValue)[jss::ledger_index] ==
+                    env.closed()->seq())
+                    return;
+                std::this_thread::sleep_for(10ms);
+            }
+            fail("ledger not published");
+        };
+        close();
+
+        auto dueDate = [&](uint256 const& loanID) {
+            return env.le(keylet::loan(loanID))->at(sfNextPaymentDueDate);
+        };
+
+        {
+            auto const result = loansDue(Json::objectValue);
+            BEAST_EXPECT(!result.isMember(jss::error));
+            BEAST_EXPECT(result[jss::ledger_index] == env.closed()->seq());
+            BEAST_EXPECT(!result.isMember(jss::marker));
+            auto const& loans = result[jss::loans];
+            if (BEAST_EXPECT(loans.size() == 3))
+            {
+                for (auto const i : {0u, 1u, 2u})
+                {
+                    auto const& loanID = loanIDs[(i + 1) % 3];
+                    BEAST_EXPECT(loans[i][jss::loan_id] == to_string(loanID));
+                    BEAST_EXPECT(loans[i][jss::due_date] == dueDate(loanID));
+                    BEAST_EXPECT(loans[i][jss::late] == false);
+                }
+            }
+        }
+
+        {
+            // Only the loans due before the given time
+            Json::Value params;
+            params[jss::due_before] = dueDate(loanIDs[2]);
+            auto const loans = loansDue(params)[jss::loans];
+            BEAST_EXPECT(
+                loans.size() == 1 &&
+                loans[0u][jss::loan_id] == to_string(loanIDs[1]));
+        }
+
+        {
+            // Page through the loans one at a time
+            std::vector<std::string> seen;
+            Json::Value params;
+            params[jss::limit] = 1;
+            for (int i = 0; i < 4; ++i)
+            {
+                auto const result = loansDue(params);
+                for (auto const& loan : result[jss::loans])
+                    seen.push_back(loan[jss::loan_id].asString());
+                if (!result.isMember(jss::marker))
+                    break;
+                params[jss::marker] = result[jss::marker];
+            }
+            BEAST_EXPECT(
+                seen ==
+                std::vector<std::string>(
+                    {to_string(loanIDs[1]),
+                     to_string(loanIDs[2]),
+                     to_string(loanIDs[0])}));
+        }
+
+        {
+            // A payment moves the loan to its next due date
+            Json::Value params;
+            params[jss::loan_id] = to_string(loanIDs[1]);
+            auto const totalDue = amountFromString(
+                broker.asset.raw(),
+                env.rpc("json", "loan_info", to_string(params))
+                    [jss::result][jss::next_payment][jss::total_due]
+                        .asString());
+            auto const before = dueDate(loanIDs[1]);
+            env(pay(borrower, loanIDs[1], totalDue));
+            close();
+            BEAST_EXPECT(dueDate(loanIDs[1]) > before);
+
+            auto const loans = loansDue(Json::objectValue)[jss::loans];
+            if (BEAST_EXPECT(loans.size() == 3))
+            {
+                BEAST_EXPECT(loans[0u][jss::loan_id] == to_string(loanIDs[1]));
+                BEAST_EXPECT(loans[0u][jss::due_date] == dueDate(loanIDs[1]));
+            }
+        }
+
+        {
+            // Loans past their due date are late
+            close(env.now() + 3000s);
+            auto const loans = loansDue(Json::objectValue)[jss::loans];
+            if (BEAST_EXPECT(loans.size() == 3))
+            {
+                BEAST_EXPECT(loans[0u][jss::late] == true);
+                BEAST_EXPECT(loans[1u][jss::late] == true);
+                BEAST_EXPECT(loans[2u][jss::late] == false);
+            }
+        }
+
+        {
+            // Invalid requests
+            auto const noBroker =
+                env.rpc(
+                    "json",
+                    "loans_due",
+                    to_string(Json::Value(Json::objectValue)))[jss::result];
+            BEAST_EXPECT(noBroker[jss::error] == "invalidParams");
+
+            Json::Value params;
+            params[jss::marker] = "not a marker";
+            BEAST_EXPECT(loansDue(params)[jss::error] == "invalidParams");
+
+            params.removeMember(jss::marker);
+            params[jss::due_before] = -1;
+            BEAST_EXPECT(loansDue(params)[jss::error] == "invalidParams");
+
+            // A broker with no loans
+            params = Json::objectValue;
+            params[jss::loan_broker_id] = to_string(loanIDs[0]);
+            auto const result =
+                env.rpc("json", "loans_due", to_string(params))[jss::result];
+            BEAST_EXPECT(
+                result[jss::loans].isArray() && result[jss::loans].size() == 0);
+        }
+    }
+
     void
     run() override
     {
@@ -4597,6 +5159,10 @@ public:
 
         testRPC();
         testBasicMath();
+        testAmortizationTable();
+        testLoanRateCache();
+        testLoanInfoRPC();
+        testLoansDueRPC();
 
         testInvalidLoanDelete();
         testInvalidLoanManage();
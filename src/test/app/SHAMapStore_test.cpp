@@ -575,7 +575,8 @@ public:
                 std::to_string(env.app().config().getValueFor(
                     SizedItem::treeCacheAge, std::nullopt)));
 
-        NodeStoreScheduler scheduler(env.app().getJobQueue());
+        NodeStoreScheduler scheduler(
+            env.app().getJobQueue(), beast::insight::NullCollector::New());
 
         std::string const writableDb = "write";
         std::string const archiveDb = "archive";
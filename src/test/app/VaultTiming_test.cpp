@@ -0,0 +1,127 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <test/jtx.h>
+#include <test/jtx/envconfig.h>
+#include <test/jtx/vault.h>
+
+#include <xrpl/beast/unit_test.h>
+#include <xrpl/protocol/Indexes.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace ripple {
+namespace test {
+
+// NOTE This is a rather naive benchmark of applying many vault transactions
+// to the same vault in one ledger. It reports transactions per second, so it
+// is most useful to compare two builds on the same machine.
+
+class VaultTiming_test : public beast::unit_test::suite
+{
+    template <class F>
+    void
+    time(char const* name, std::size_t n, F&& f)
+    {
+        using clock = std::chrono::steady_clock;
+
+        auto const start = clock::now();
+        f();
+        auto const elapsed =
+            std::chrono::duration_cast<std::chrono::duration<double>>(
+                clock::now() - start);
+
+        log << name << ": " << n / elapsed.count() << " tx/s (" << n
+            << " txs in " << elapsed.count() << " s)" << std::endl;
+    }
+
+    void
+    testDeposits(std::size_t depositors, std::size_t depositsEach)
+    {
+        using namespace jtx;
+
+        auto const deposits = depositors * depositsEach;
+        testcase << deposits << " deposits into one vault";
+
+        // Keep the open ledger fee from escalating, so every deposit is
+        // applied to the same ledger
+        Env env{*this, envconfig([&](std::unique_ptr<Config> cfg) {
+                    cfg->section("transaction_queue")
+                        .set(
+                            "minimum_txn_in_ledger_standalone",
+                            std::to_string(2 * deposits));
+                    return cfg;
+                })};
+        env.disable_sigs();
+
+        Account const issuer{"issuer"};
+        Account const owner{"owner"};
+        PrettyAsset const asset = issuer["IOU"];
+
+        std::vector<Account> accounts;
+        accounts.reserve(depositors);
+        for (std::size_t i = 0; i < depositors; ++i)
+            accounts.emplace_back("depositor" + std::to_string(i));
+
+        env.fund(XRP(1'000'000), issuer, owner);
+        env.close();
+        for (auto const& account : accounts)
+        {
+            env.fund(XRP(10'000), account);
+            env.trust(asset(1'000'000), account);
+            env(pay(issuer, account, asset(1'000'000)));
+        }
+        env.close();
+
+        Vault vault{env};
+        auto [tx, keylet] = vault.create({.owner = owner, .asset = asset});
+        env(tx);
+        env.close();
+
+        time("apply to open ledger", deposits, [&]() {
+            for (std::size_t i = 0; i < depositsEach; ++i)
+            {
+                for (auto const& account : accounts)
+                    env(vault.deposit(
+                        {.depositor = account,
+                         .id = keylet.key,
+                         .amount = asset(10)}));
+            }
+        });
+        time("close ledger", deposits, [&]() { env.close(); });
+
+        auto const sle = env.le(keylet);
+        BEAST_EXPECT(
+            sle && sle->at(sfAssetsTotal) == asset(10 * deposits).number());
+    }
+
+public:
+    void
+    run() override
+    {
+        testDeposits(100, 100);
+    }
+};
+
+BEAST_DEFINE_TESTSUITE_MANUAL(VaultTiming, app, ripple);
+
+}  // namespace test
+}  // namespace ripple
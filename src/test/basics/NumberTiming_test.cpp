@@ -0,0 +1,233 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <xrpl/basics/Number.h>
+#include <xrpl/beast/unit_test.h>
+#include <xrpl/beast/xor_shift_engine.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace ripple {
+
+// NOTE This is a rather naive microbenchmark of the Number arithmetic
+// operations. It reports the mean time per operation, so it is most useful
+// to compare two builds on the same machine.
+
+class NumberTiming_test : public beast::unit_test::suite
+{
+    // Number of operations timed for each case
+    static constexpr std::size_t iterations = 2'000'000;
+
+    struct Operands
+    {
+        std::vector<Number> lhs;
+        std::vector<Number> rhs;
+    };
+
+    static Operands
+    makeOperands(std::size_t count, int minExponent, int maxExponent)
+    {
+        beast::xor_shift_engine gen{count};
+        std::uniform_int_distribution<std::int64_t> mantissa{
+            Number::minMantissa, Number::maxMantissa};
+        std::uniform_int_distribution<int> exponent{minExponent, maxExponent};
+        std::bernoulli_distribution negative{0.25};
+
+        auto make = [&]() {
+            auto const m = mantissa(gen);
+            return Number{negative(gen) ? -m : m, exponent(gen)};
+        };
+
+        Operands result;
+        result.lhs.reserve(count);
+        result.rhs.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            result.lhs.push_back(make());
+            result.rhs.push_back(make());
+        }
+        return result;
+    }
+
+    template <class F>
+    void
+    time(char const* name, std::size_t n, F&& f)
+    {
+        using clock = std::chrono::steady_clock;
+
+        // Keep the optimizer from discarding the results
+        std::int64_t sink = 0;
+        auto const start = clock::now();
+        for (std::size_t i = 0; i < n; ++i)
+            sink += f(i).mantissa() & 1;
+        auto const elapsed =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                clock::now() - start);
+
+        log << name << ": "
+            << static_cast<double>(elapsed.count()) / static_cast<double>(n)
+            << " ns/op (" << n << " ops, checksum " << sink << ")"
+            << std::endl;
+        pass();
+    }
+
+    void
+    testArithmetic(Number::rounding_mode mode)
+    {
+        static std::array<char const*, 4> const modes{
+            "to_nearest", "towards_zero", "downward", "upward"};
+        testcase << "Arithmetic, " << modes[mode];
+
+        NumberRoundModeGuard mg(mode);
+
+        // A power of 2 keeps the index math cheap
+        std::size_t const count = 4096;
+        auto const ops = makeOperands(count, -20, 20);
+        auto const& x = ops.lhs;
+        auto const& y = ops.rhs;
+        auto const mask = count - 1;
+
+        time("construct", iterations, [&](std::size_t i) {
+            return Number{y[i & mask].mantissa() * 7, x[i & mask].exponent()};
+        });
+        time("add", iterations, [&](std::size_t i) {
+            return x[i & mask] + y[i & mask];
+        });
+        time("subtract", iterations, [&](std::size_t i) {
+            return x[i & mask] - y[i & mask];
+        });
+        time("multiply", iterations, [&](std::size_t i) {
+            return x[i & mask] * y[i & mask];
+        });
+        time("divide", iterations, [&](std::size_t i) {
+            return x[i & mask] / y[i & mask];
+        });
+    }
+
+    // The implementations of power() and root2() before they were replaced
+    // by the current kernels, kept to compare both speed and results.
+    static Number
+    referencePower(Number const& f, unsigned n)
+    {
+        if (n == 0)
+            return Number{1};
+        if (n == 1)
+            return f;
+        auto r = referencePower(f, n / 2);
+        r *= r;
+        if (n % 2 != 0)
+            r *= f;
+        return r;
+    }
+
+    static Number
+    referenceRoot2(Number f)
+    {
+        if (f == Number{1} || f == Number{})
+            return f;
+        auto e = f.exponent() + 16;
+        if (e % 2 != 0)
+            ++e;
+        f = Number{f.mantissa(), f.exponent() - e};
+        Number r =
+            ((Number{-60} * f + Number{144}) * f + Number{18}) / Number{105};
+        Number rm1{};
+        Number rm2{};
+        do
+        {
+            rm2 = rm1;
+            rm1 = r;
+            r = (r + f / r) / Number(2);
+        } while (r != rm1 && r != rm2);
+        return Number{r.mantissa(), r.exponent() + e / 2};
+    }
+
+    void
+    testLoanMath()
+    {
+        testcase("Loan math");
+
+        // Typical periodic rates: 0.1% to 20% annual, paid monthly
+        std::size_t const count = 1024;
+        std::vector<Number> rates;
+        rates.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+            rates.push_back(
+                Number{static_cast<std::int64_t>(1 + i % 200), -3} / 12);
+        auto const mask = count - 1;
+
+        // Loan terms from one year to thirty years of monthly payments
+        for (unsigned const payments : {12u, 24u, 36u, 60u, 120u, 240u, 360u})
+        {
+            for (auto const& rate : rates)
+            {
+                BEAST_EXPECT(
+                    power(1 + rate, payments) ==
+                    referencePower(1 + rate, payments));
+            }
+            auto const suffix = std::to_string(payments) + ")";
+            time(
+                ("reference power(1 + rate, " + suffix).c_str(),
+                iterations / 10,
+                [&](std::size_t i) {
+                    return referencePower(1 + rates[i & mask], payments);
+                });
+            time(
+                ("power(1 + rate, " + suffix).c_str(),
+                iterations / 10,
+                [&](std::size_t i) {
+                    return power(1 + rates[i & mask], payments);
+                });
+        }
+
+        for (auto const& rate : rates)
+            BEAST_EXPECT(root2(1 + rate) == referenceRoot2(1 + rate));
+        time("reference root2", iterations / 10, [&](std::size_t i) {
+            return referenceRoot2(1 + rates[i & mask]);
+        });
+        time("root2", iterations / 10, [&](std::size_t i) {
+            return root2(1 + rates[i & mask]);
+        });
+        time("root(3)", iterations / 100, [&](std::size_t i) {
+            return root(1 + rates[i & mask], 3);
+        });
+    }
+
+public:
+    void
+    run() override
+    {
+        for (auto const mode :
+             {Number::to_nearest,
+              Number::towards_zero,
+              Number::downward,
+              Number::upward})
+            testArithmetic(mode);
+        testLoanMath();
+    }
+};
+
+BEAST_DEFINE_TESTSUITE_MANUAL(NumberTiming, basics, ripple);
+
+}  // namespace ripple
@@ -0,0 +1,161 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <test/unit_test/SuiteJournal.h>
+
+#include <xrpl/basics/ShardedTaggedCache.h>
+#include <xrpl/basics/TaggedCache.ipp>
+#include <xrpl/basics/chrono.h>
+#include <xrpl/protocol/Protocol.h>
+
+#include <algorithm>
+#include <set>
+#include <string>
+
+namespace ripple {
+
+class ShardedTaggedCache_test : public beast::unit_test::suite
+{
+    using Key = LedgerIndex;
+    using Value = std::string;
+    using Cache = ShardedTaggedCache<Key, Value>;
+
+    void
+    testCache(test::SuiteJournal& journal)
+    {
+        using namespace std::chrono_literals;
+        testcase("cache");
+
+        TestStopwatch clock;
+        clock.set(0);
+
+        Cache c("test", 4, 1s, clock, journal, 4);
+        BEAST_EXPECT(c.shards() == 4);
+
+        // Insert some items, retrieve them, and age them so they get purged.
+        {
+            for (Key k = 1; k <= 16; ++k)
+                BEAST_EXPECT(!c.insert(k, std::to_string(k)));
+            BEAST_EXPECT(c.getCacheSize() == 16);
+            BEAST_EXPECT(c.getTrackSize() == 16);
+            BEAST_EXPECT(c.size() == 16);
+
+            for (Key k = 1; k <= 16; ++k)
+            {
+                std::string s;
+                BEAST_EXPECT(c.retrieve(k, s));
+                BEAST_EXPECT(s == std::to_string(k));
+            }
+
+            auto keys = c.getKeys();
+            std::sort(keys.begin(), keys.end());
+            BEAST_EXPECT(keys.size() == 16);
+            BEAST_EXPECT(keys.front() == 1 && keys.back() == 16);
+
+            ++clock;
+            c.sweep();
+            BEAST_EXPECT(c.getCacheSize() == 0);
+            BEAST_EXPECT(c.getTrackSize() == 0);
+        }
+
+        // Keep a strong pointer to an item, age it, and verify that the
+        // entry is still tracked until the pointer is gone.
+        {
+            BEAST_EXPECT(!c.insert(2, "two"));
+            {
+                auto p = c.fetch(2);
+                BEAST_EXPECT(p != nullptr);
+                ++clock;
+                c.sweep();
+                BEAST_EXPECT(c.getCacheSize() == 0);
+                BEAST_EXPECT(c.getTrackSize() == 1);
+
+                // Canonicalizing a new object with the same key gives the
+                // original object
+                auto p2 = std::make_shared<Value>("two");
+                BEAST_EXPECT(c.canonicalize_replace_client(2, p2));
+                BEAST_EXPECT(p.get() == p2.get());
+                BEAST_EXPECT(c.getCacheSize() == 1);
+            }
+
+            ++clock;
+            c.sweep();
+            BEAST_EXPECT(c.getCacheSize() == 0);
+            BEAST_EXPECT(c.getTrackSize() == 0);
+        }
+
+        // Delete an item
+        {
+            BEAST_EXPECT(!c.insert(3, "three"));
+            BEAST_EXPECT(c.del(3, false));
+            BEAST_EXPECT(!c.fetch(3));
+            BEAST_EXPECT(c.getTrackSize() == 0);
+        }
+    }
+
+    void
+    testShards(test::SuiteJournal& journal)
+    {
+        using namespace std::chrono_literals;
+        testcase("shards");
+
+        TestStopwatch clock;
+        clock.set(0);
+
+        // Every key belongs to exactly one shard
+        Cache c("test", 64, 1s, clock, journal, 8);
+        for (Key k = 0; k < 1024; ++k)
+            BEAST_EXPECT(!c.insert(k, std::to_string(k)));
+        for (Key k = 0; k < 1024; ++k)
+            BEAST_EXPECT(c.insert(k, std::to_string(k)));
+        BEAST_EXPECT(c.getCacheSize() == 1024);
+
+        std::set<Key> seen;
+        for (auto const& k : c.getKeys())
+            BEAST_EXPECT(seen.insert(k).second);
+        BEAST_EXPECT(seen.size() == 1024);
+
+        // Aged entries are swept from every shard
+        ++clock;
+        c.sweep();
+        BEAST_EXPECT(c.getCacheSize() == 0);
+
+        c.reset();
+        BEAST_EXPECT(c.size() == 0);
+        BEAST_EXPECT(c.getHitRate() == 0);
+
+        // A default cache has at least one shard
+        Cache d("test", 0, 1s, clock, journal);
+        BEAST_EXPECT(d.shards() >= 1);
+    }
+
+public:
+    void
+    run() override
+    {
+        test::SuiteJournal journal("ShardedTaggedCache_test", *this);
+
+        testCache(journal);
+        testShards(journal);
+    }
+};
+
+BEAST_DEFINE_TESTSUITE(ShardedTaggedCache, basics, ripple);
+
+}  // namespace ripple
@@ -0,0 +1,163 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <test/unit_test/SuiteJournal.h>
+
+#include <xrpl/basics/ShardedTaggedCache.h>
+#include <xrpl/basics/TaggedCache.ipp>
+#include <xrpl/basics/base_uint.h>
+#include <xrpl/basics/chrono.h>
+#include <xrpl/beast/unit_test.h>
+#include <xrpl/beast/xor_shift_engine.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ripple {
+
+// NOTE This is a rather naive benchmark of lock contention in TaggedCache and
+// ShardedTaggedCache. Several threads fetch and canonicalize random keys while
+// another thread sweeps the cache, and it reports the lookups per second, so
+// it is most useful to compare the two caches on the same machine.
+
+class TaggedCacheTiming_test : public beast::unit_test::suite
+{
+    // Number of lookups made by each thread
+    static constexpr std::size_t iterations = 1'000'000;
+
+    // Number of distinct keys, more than the caches are sized for
+    static constexpr std::size_t keyCount = 1 << 18;
+
+    static std::vector<uint256>
+    makeKeys()
+    {
+        beast::xor_shift_engine gen{keyCount};
+        std::uniform_int_distribution<std::uint64_t> dist;
+
+        std::vector<uint256> keys;
+        keys.reserve(keyCount);
+        for (std::size_t i = 0; i < keyCount; ++i)
+        {
+            uint256 key;
+            for (auto& b : key)
+                b = static_cast<std::uint8_t>(dist(gen));
+            keys.push_back(key);
+        }
+        return keys;
+    }
+
+    template <class Cache>
+    void
+    time(
+        char const* name,
+        Cache& cache,
+        std::vector<uint256> const& keys,
+        std::size_t threads)
+    {
+        using clock = std::chrono::steady_clock;
+
+        std::atomic<bool> done = false;
+        std::thread sweeper([&]() {
+            while (!done)
+            {
+                cache.sweep();
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+        });
+
+        std::atomic<std::size_t> hits = 0;
+        auto const start = clock::now();
+        std::vector<std::thread> workers;
+        for (std::size_t t = 0; t < threads; ++t)
+        {
+            workers.emplace_back([&, t]() {
+                beast::xor_shift_engine gen{t + 1};
+                std::uniform_int_distribution<std::size_t> dist{
+                    0, keys.size() - 1};
+                std::size_t found = 0;
+                for (std::size_t i = 0; i < iterations; ++i)
+                {
+                    auto const& key = keys[dist(gen)];
+                    if (cache.fetch(key))
+                    {
+                        ++found;
+                        continue;
+                    }
+                    auto value = std::make_shared<std::string>("value");
+                    cache.canonicalize_replace_client(key, value);
+                }
+                hits += found;
+            });
+        }
+        for (auto& worker : workers)
+            worker.join();
+        auto const elapsed =
+            std::chrono::duration_cast<std::chrono::duration<double>>(
+                clock::now() - start);
+
+        done = true;
+        sweeper.join();
+
+        auto const lookups = threads * iterations;
+        log << name << ", " << threads
+            << " threads: " << lookups / elapsed.count() << " lookups/s ("
+            << 100.0 * hits / lookups << "% hits)" << std::endl;
+        pass();
+    }
+
+public:
+    void
+    run() override
+    {
+        using namespace std::chrono_literals;
+        test::SuiteJournal journal("TaggedCacheTiming_test", *this);
+
+        auto const keys = makeKeys();
+        auto const hardware =
+            std::max<std::size_t>(1, std::thread::hardware_concurrency());
+
+        for (std::size_t threads : {std::size_t{1}, hardware, 2 * hardware})
+        {
+            testcase << threads << " threads";
+            {
+                TaggedCache<uint256, std::string> cache(
+                    "TaggedCache", keyCount / 2, 1s, stopwatch(), journal);
+                time("TaggedCache", cache, keys, threads);
+            }
+            {
+                ShardedTaggedCache<uint256, std::string> cache(
+                    "ShardedTaggedCache",
+                    keyCount / 2,
+                    1s,
+                    stopwatch(),
+                    journal);
+                time("ShardedTaggedCache", cache, keys, threads);
+            }
+        }
+    }
+};
+
+BEAST_DEFINE_TESTSUITE_MANUAL(TaggedCacheTiming, basics, ripple);
+
+}  // namespace ripple
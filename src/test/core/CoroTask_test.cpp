@@ -0,0 +1,302 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <test/jtx.h>
+
+#include <xrpld/core/CoroTask.h>
+
+#include <xrpl/basics/LocalValue.h>
+#include <xrpl/basics/contract.h>
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+
+namespace ripple {
+namespace test {
+
+class CoroTask_test : public beast::unit_test::suite
+{
+public:
+    class gate
+    {
+    private:
+        std::condition_variable cv_;
+        std::mutex mutex_;
+        bool signaled_ = false;
+
+    public:
+        // Thread safe, blocks until signaled or period expires.
+        // Returns `true` if signaled.
+        template <class Rep, class Period>
+        bool
+        wait_for(std::chrono::duration<Rep, Period> const& rel_time)
+        {
+            std::unique_lock<std::mutex> lk(mutex_);
+            auto b = cv_.wait_for(lk, rel_time, [this] { return signaled_; });
+            signaled_ = false;
+            return b;
+        }
+
+        void
+        signal()
+        {
+            std::lock_guard lk(mutex_);
+            signaled_ = true;
+            cv_.notify_all();
+        }
+    };
+
+    // Signals when it is destroyed
+    struct Sentinel
+    {
+        gate& g;
+
+        ~Sentinel()
+        {
+            g.signal();
+        }
+    };
+
+    static CoroTask
+    suspendOnce(gate* g1, gate* g2, std::optional<CoroTask::Resume>* resume)
+    {
+        g1->signal();
+        co_await CoroTask::suspend(
+            [resume](CoroTask::Resume r) { *resume = std::move(r); });
+        g2->signal();
+    }
+
+    void
+    testSuspend()
+    {
+        using namespace std::chrono_literals;
+        using namespace jtx;
+
+        testcase("suspend and resume");
+
+        Env env(*this, envconfig([](std::unique_ptr<Config> cfg) {
+            cfg->FORCE_MULTI_THREAD = true;
+            return cfg;
+        }));
+
+        gate g1, g2;
+        std::optional<CoroTask::Resume> resume;
+        BEAST_EXPECT(env.app().getJobQueue().postCoroTask(
+            jtCLIENT, "CoroTask-Test", suspendOnce(&g1, &g2, &resume)));
+        BEAST_EXPECT(g1.wait_for(5s));
+
+        // The Resume is handed out once the coroutine is suspended
+        env.app().getJobQueue().rendezvous();
+        BEAST_EXPECT(resume.has_value());
+        BEAST_EXPECT(!g2.wait_for(10ms));
+        BEAST_EXPECT((*resume)());
+        BEAST_EXPECT(g2.wait_for(5s));
+    }
+
+    static CoroTask
+    resumeAtOnce(gate* g, int* count)
+    {
+        for (int i = 0; i < 10; ++i)
+        {
+            co_await CoroTask::suspend([](CoroTask::Resume r) { r(); });
+            ++*count;
+        }
+        g->signal();
+    }
+
+    void
+    testResumeAtOnce()
+    {
+        using namespace std::chrono_literals;
+        using namespace jtx;
+
+        testcase("resume while suspending");
+
+        Env env(*this, envconfig([](std::unique_ptr<Config> cfg) {
+            cfg->FORCE_MULTI_THREAD = true;
+            return cfg;
+        }));
+
+        gate g;
+        int count = 0;
+        BEAST_EXPECT(env.app().getJobQueue().postCoroTask(
+            jtCLIENT, "CoroTask-Test", resumeAtOnce(&g, &count)));
+        BEAST_EXPECT(g.wait_for(5s));
+        BEAST_EXPECT(count == 10);
+    }
+
+    static CoroTask
+    abandoned(gate* started, gate* destroyed)
+    {
+        Sentinel sentinel{*destroyed};
+        started->signal();
+        // Nothing keeps the Resume, so the coroutine is destroyed
+        co_await CoroTask::suspend([](CoroTask::Resume) {});
+        // LCOV_EXCL_START
+        UNREACHABLE("ripple::test::CoroTask_test::abandoned : resumed");
+        // LCOV_EXCL_STOP
+    }
+
+    void
+    testDestroy()
+    {
+        using namespace std::chrono_literals;
+        using namespace jtx;
+
+        testcase("destroy");
+
+        Env env(*this);
+        auto& jq = env.app().getJobQueue();
+
+        {
+            // Abandoned while suspended
+            gate started, destroyed;
+            BEAST_EXPECT(jq.postCoroTask(
+                jtCLIENT, "CoroTask-Test", abandoned(&started, &destroyed)));
+            BEAST_EXPECT(started.wait_for(5s));
+            BEAST_EXPECT(destroyed.wait_for(5s));
+        }
+
+        {
+            // Never run, since the JobQueue is stopped
+            jq.stop();
+            gate started, destroyed;
+            BEAST_EXPECT(!jq.postCoroTask(
+                jtCLIENT, "CoroTask-Test", abandoned(&started, &destroyed)));
+            BEAST_EXPECT(!started.wait_for(10ms));
+            BEAST_EXPECT(destroyed.wait_for(5s));
+        }
+    }
+
+    static CoroTask
+    localValue(
+        beast::unit_test::suite* suite,
+        LocalValue<int>* lv,
+        int id,
+        gate* g,
+        std::optional<CoroTask::Resume>* resume)
+    {
+        suite->expect(**lv == -1);
+        **lv = id;
+        g->signal();
+        co_await CoroTask::suspend(
+            [resume](CoroTask::Resume r) { *resume = std::move(r); });
+
+        suite->expect(**lv == id);
+        g->signal();
+    }
+
+    void
+    testLocalValue()
+    {
+        using namespace std::chrono_literals;
+        using namespace jtx;
+
+        testcase("thread specific storage");
+
+        Env env(*this);
+        auto& jq = env.app().getJobQueue();
+
+        static int const N = 4;
+        std::array<std::optional<CoroTask::Resume>, N> resumes;
+
+        LocalValue<int> lv(-1);
+
+        gate g;
+        for (int i = 0; i < N; ++i)
+        {
+            BEAST_EXPECT(jq.postCoroTask(
+                jtCLIENT,
+                "CoroTask-Test",
+                localValue(this, &lv, i, &g, &resumes[i])));
+            BEAST_EXPECT(g.wait_for(5s));
+        }
+        jq.rendezvous();
+
+        for (auto& resume : resumes)
+        {
+            BEAST_EXPECT(resume.has_value() && (*resume)());
+            BEAST_EXPECT(g.wait_for(5s));
+        }
+
+        BEAST_EXPECT(*lv == -1);
+    }
+
+    static CoroTask
+    throws(LocalValue<int>* lv, gate* destroyed)
+    {
+        Sentinel sentinel{*destroyed};
+        **lv = 1;
+        co_await CoroTask::suspend([](CoroTask::Resume r) { r(); });
+        **lv = 2;
+        Throw<std::runtime_error>("CoroTask_test");
+    }
+
+    void
+    testException()
+    {
+        using namespace std::chrono_literals;
+        using namespace jtx;
+
+        testcase("exception");
+
+        // The JobQueue of a standalone Env has one thread, so every job
+        // runs on the thread which ran the coroutine
+        Env env(*this);
+        auto& jq = env.app().getJobQueue();
+
+        LocalValue<int> lv(-1);
+
+        // The coroutine is destroyed, and the job which ran it returns
+        gate destroyed;
+        BEAST_EXPECT(jq.postCoroTask(
+            jtCLIENT, "CoroTask-Test", throws(&lv, &destroyed)));
+        BEAST_EXPECT(destroyed.wait_for(5s));
+        jq.rendezvous();
+
+        // That thread has its own LocalValue instances back
+        gate g;
+        int value = 0;
+        BEAST_EXPECT(jq.addJob(jtCLIENT, "CoroTask-Test", [&]() {
+            value = *lv;
+            g.signal();
+        }));
+        BEAST_EXPECT(g.wait_for(5s));
+        BEAST_EXPECT(value == -1);
+    }
+
+    void
+    run() override
+    {
+        testSuspend();
+        testResumeAtOnce();
+        testDestroy();
+        testLocalValue();
+        testException();
+    }
+};
+
+BEAST_DEFINE_TESTSUITE(CoroTask, core, ripple);
+
+}  // namespace test
+}  // namespace ripple
@@ -0,0 +1,199 @@
+//------------------------------------------------------------------------------
+/*
+This file is part of rippled: https://github.com/ripple/rippled
+Copyright (c) 2025 Ripple Labs Inc.
+
+Permission to use, copy, modify, and/or distribute this software for any
+purpose  with  or without fee is hereby granted, provided that the above
+copyright notice and this permission notice appear in all copies.
+
+THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <xrpld/core/JobQueue.h>
+#include <xrpld/perflog/PerfLog.h>
+
+#include <xrpl/basics/Log.h>
+#include <xrpl/beast/insight/NullCollector.h>
+#include <xrpl/beast/unit_test.h>
+#include <xrpl/json/json_value.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ripple {
+namespace test {
+
+// NOTE This is a rather naive benchmark of the overhead of the JobQueue. It
+// adds many short jobs of a mix of types from several threads, some of which
+// add a job of their own, as relayed messages do, and reports the rate at
+// which the jobs run for each number of threads. It is most useful to compare
+// two builds on the same machine.
+
+class JobQueueTiming_test : public beast::unit_test::suite
+{
+    class NullPerfLog : public perf::PerfLog
+    {
+        void
+        rpcStart(std::string const&, std::uint64_t) override
+        {
+        }
+
+        void
+        rpcFinish(std::string const&, std::uint64_t) override
+        {
+        }
+
+        void
+        rpcError(std::string const&, std::uint64_t) override
+        {
+        }
+
+        void
+        jobQueue(JobType const) override
+        {
+        }
+
+        void
+        jobStart(
+            JobType const,
+            std::chrono::microseconds,
+            std::chrono::time_point<std::chrono::steady_clock>,
+            int) override
+        {
+        }
+
+        void
+        jobFinish(JobType const, std::chrono::microseconds, int) override
+        {
+        }
+
+        Json::Value
+        countersJson() const override
+        {
+            return Json::Value();
+        }
+
+        Json::Value
+        currentJson() const override
+        {
+            return Json::Value();
+        }
+
+        void
+        resizeJobs(int const) override
+        {
+        }
+
+        void
+        rotate() override
+        {
+        }
+    };
+
+    // The types of the jobs added, including one with a low limit
+    static constexpr std::array<JobType, 4> types{
+        jtTRANSACTION, jtPROPOSAL_t, jtCLIENT_RPC, jtLEDGER_DATA};
+
+    // A little work, so the jobs are not entirely overhead
+    static std::uint64_t
+    work(std::uint64_t seed)
+    {
+        for (int i = 0; i < 64; ++i)
+            seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        return seed;
+    }
+
+    void
+    testThreads(int threads, std::size_t jobs)
+    {
+        testcase << threads << " threads, " << jobs << " jobs";
+
+        Logs logs{beast::severities::kError};
+        NullPerfLog perfLog;
+        JobQueue jq(
+            threads,
+            beast::insight::NullCollector::New(),
+            logs.journal("JobQueue"),
+            logs,
+            perfLog);
+
+        std::atomic<std::size_t> ran{0};
+        std::atomic<std::uint64_t> sink{0};
+
+        auto const job = [&](std::size_t i) {
+            sink += work(i);
+            ++ran;
+        };
+
+        // Jobs are added from as many threads as there are workers, as
+        // peers and clients do
+        using clock = std::chrono::steady_clock;
+        auto const start = clock::now();
+        {
+            std::vector<std::thread> producers;
+            for (int p = 0; p < threads; ++p)
+            {
+                producers.emplace_back([&, p]() {
+                    for (std::size_t i = p; i < jobs; i += threads)
+                    {
+                        auto const type = types[i % types.size()];
+                        if (i % 4 == 0)
+                        {
+                            // Relay the message once it is checked
+                            jq.addJob(type, "timing", [&, i]() {
+                                job(i);
+                                jq.addJob(jtTRANSACTION, "timing", [&, i]() {
+                                    job(i);
+                                });
+                            });
+                        }
+                        else
+                        {
+                            jq.addJob(type, "timing", [&, i]() { job(i); });
+                        }
+                    }
+                });
+            }
+            for (auto& producer : producers)
+                producer.join();
+        }
+        jq.rendezvous();
+        auto const elapsed =
+            std::chrono::duration_cast<std::chrono::duration<double>>(
+                clock::now() - start);
+
+        auto const total = jobs + (jobs + 3) / 4;
+        log << threads << " threads: " << total / elapsed.count()
+            << " jobs/s (" << total << " jobs in " << elapsed.count()
+            << " s)" << std::endl;
+        BEAST_EXPECT(ran == total);
+
+        jq.stop();
+    }
+
+public:
+    void
+    run() override
+    {
+        std::size_t const jobs = 1'000'000;
+        for (int threads : {8, 16, 32, 64})
+            testThreads(threads, jobs);
+    }
+};
+
+BEAST_DEFINE_TESTSUITE_MANUAL(JobQueueTiming, core, ripple);
+
+}  // namespace test
+}  // namespace ripple
@@ -0,0 +1,155 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <test/nodestore/TestBase.h>
+
+#include <xrpld/nodestore/detail/BatchWriter.h>
+
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace ripple {
+namespace NodeStore {
+
+class BatchWriter_test : public TestBase
+{
+    // Runs each task on a thread of its own, like the job queue would
+    struct ThreadScheduler : Scheduler
+    {
+        std::mutex mutex;
+        std::vector<std::thread> threads;
+        std::atomic<int> writes{0};
+
+        ~ThreadScheduler()
+        {
+            for (auto& t : threads)
+                t.join();
+        }
+
+        void
+        scheduleTask(Task& task) override
+        {
+            std::lock_guard lock(mutex);
+            threads.emplace_back([&task]() { task.performScheduledTask(); });
+        }
+
+        void
+        onFetch(FetchReport const&) override
+        {
+        }
+
+        void
+        onBatchWrite(BatchWriteReport const&) override
+        {
+            ++writes;
+        }
+    };
+
+    struct Writer : BatchWriter::Callback
+    {
+        std::mutex mutex;
+        std::set<uint256> written;
+        std::size_t largest = 0;
+
+        void
+        writeBatch(Batch const& batch) override
+        {
+            std::lock_guard lock(mutex);
+            largest = std::max(largest, batch.size());
+            for (auto const& object : batch)
+                written.insert(object->getHash());
+        }
+    };
+
+    void
+    testConcurrentStores()
+    {
+        testcase("concurrent stores");
+
+        auto const batch = createPredictableBatch(20'000, 1);
+
+        ThreadScheduler scheduler;
+        Writer writer;
+        {
+            BatchWriter bw(writer, scheduler, "test");
+            BEAST_EXPECT(bw.getBatchSize() == batchWriteLimitSize);
+
+            std::vector<std::thread> threads;
+            std::size_t const n = 8;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                threads.emplace_back([&, i]() {
+                    for (auto j = i; j < batch.size(); j += n)
+                        bw.store(batch[j]);
+                });
+            }
+            for (auto& t : threads)
+                t.join();
+            // Destroying the writer waits for everything to be written
+        }
+
+        BEAST_EXPECT(writer.written.size() == batch.size());
+        BEAST_EXPECT(writer.largest <= batchWriteLimitSize);
+        BEAST_EXPECT(scheduler.writes > 0);
+    }
+
+    void
+    testOrder()
+    {
+        testcase("order");
+
+        // Objects stored by one caller are written in the order stored
+        struct OrderedWriter : BatchWriter::Callback
+        {
+            Batch written;
+
+            void
+            writeBatch(Batch const& batch) override
+            {
+                written.insert(written.end(), batch.begin(), batch.end());
+            }
+        };
+
+        auto const batch = createPredictableBatch(1'000, 2);
+
+        ThreadScheduler scheduler;
+        OrderedWriter writer;
+        {
+            BatchWriter bw(writer, scheduler, "test");
+            for (auto const& object : batch)
+                bw.store(object);
+        }
+        BEAST_EXPECT(areBatchesEqual(batch, writer.written));
+    }
+
+public:
+    void
+    run() override
+    {
+        testConcurrentStores();
+        testOrder();
+    }
+};
+
+BEAST_DEFINE_TESTSUITE(BatchWriter, nodestore, ripple);
+
+}  // namespace NodeStore
+}  // namespace ripple
@@ -0,0 +1,187 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <test/nodestore/TestBase.h>
+#include <test/unit_test/SuiteJournal.h>
+
+#include <xrpld/core/ZstdDictionary.h>
+#include <xrpld/nodestore/DummyScheduler.h>
+#include <xrpld/nodestore/Manager.h>
+#include <xrpld/nodestore/detail/codec.h>
+
+#include <xrpl/basics/BasicConfig.h>
+#include <xrpl/basics/ByteUtilities.h>
+
+#include <boost/algorithm/string.hpp>
+
+#include <nudb/detail/buffer.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+namespace ripple {
+namespace NodeStore {
+
+// NOTE This is a rather naive benchmark of the node object codecs. It
+// compresses a set of leaf objects with LZ4 and with zstd and a dictionary,
+// and reports the compression ratio and the time to compress and decode each
+// object. Inner nodes are left out, since they are stored by the inner node
+// codec either way.
+//
+// By default the objects are generated ledger entries, and the dictionary is
+// trained on other generated entries. For real numbers, give a node store to
+// read the objects from and a dictionary trained on it:
+//
+// --unittest-arg=path=<path>,dictionary=<file>[,type=<type>][,count=<n>]
+
+class CodecTiming_test : public beast::unit_test::suite
+{
+    using clock_type = std::chrono::steady_clock;
+
+    void
+    report(
+        std::string const& name,
+        std::vector<Blob> const& objects,
+        ZstdDictionary const* dictionary)
+    {
+        using namespace std::chrono;
+
+        std::size_t raw = 0;
+        for (auto const& object : objects)
+            raw += object.size();
+
+        std::vector<Blob> compressed;
+        compressed.reserve(objects.size());
+        auto start = clock_type::now();
+        for (auto const& object : objects)
+        {
+            nudb::detail::buffer bf;
+            auto const result = nodeobject_compress(
+                object.data(), object.size(), bf, dictionary);
+            auto const p = static_cast<std::uint8_t const*>(result.first);
+            compressed.emplace_back(p, p + result.second);
+        }
+        auto const compressTime = clock_type::now() - start;
+
+        std::size_t size = 0;
+        for (auto const& object : compressed)
+            size += object.size();
+
+        nudb::detail::buffer bf;
+        std::size_t decoded = 0;
+        start = clock_type::now();
+        for (auto const& object : compressed)
+            decoded +=
+                nodeobject_decompress(object.data(), object.size(), bf).second;
+        auto const decodeTime = clock_type::now() - start;
+        BEAST_EXPECT(decoded == raw);
+
+        auto const perObject = [&](clock_type::duration d) {
+            return duration_cast<duration<double, std::nano>>(d).count() /
+                objects.size();
+        };
+        log << std::left << std::setw(6) << name << std::right << std::fixed
+            << std::setprecision(3) << " ratio " << double(raw) / size
+            << std::setprecision(1) << ", " << double(size) / objects.size()
+            << " bytes/object, compress " << perObject(compressTime)
+            << " ns/object, decode " << perObject(decodeTime) << " ns/object"
+            << std::endl;
+    }
+
+    static std::vector<Blob>
+    leaves(Batch const& batch)
+    {
+        std::vector<Blob> result;
+        for (auto const& object : batch)
+        {
+            if (auto blob = TestBase::encodeLeaf(object))
+                result.push_back(std::move(*blob));
+        }
+        return result;
+    }
+
+public:
+    void
+    run() override
+    {
+        testcase(beast::unit_test::abort_on_fail) << arg();
+
+        Section args;
+        if (!arg().empty())
+        {
+            std::vector<std::string> v;
+            boost::split(v, arg(), boost::algorithm::is_any_of(","));
+            args.append(v);
+        }
+        auto const count = get<std::size_t>(args, "count", 100'000);
+
+        std::vector<Blob> objects;
+        std::shared_ptr<ZstdDictionary const> dictionary;
+        if (args.exists("path"))
+        {
+            std::string file;
+            if (!get_if_exists(args, "dictionary", file))
+            {
+                log << "Missing parameter: dictionary";
+                return;
+            }
+            dictionary = ZstdDictionary::load(file);
+
+            if (!args.exists("type"))
+                args.set("type", "NuDB");
+            test::SuiteJournal journal("CodecTiming_test", *this);
+            DummyScheduler scheduler;
+            auto backend = Manager::instance().make_Backend(
+                args, megabytes(4), scheduler, journal);
+            backend->open(false);
+            backend->for_each([&](std::shared_ptr<NodeObject> object) {
+                if (objects.size() >= count)
+                    return;
+                if (auto blob = TestBase::encodeLeaf(object))
+                    objects.push_back(std::move(*blob));
+            });
+            backend->close();
+        }
+        else
+        {
+            dictionary = std::make_shared<ZstdDictionary const>(
+                ZstdDictionary::train(
+                    leaves(TestBase::createLedgerEntryBatch(20'000, 1)),
+                    kilobytes(64),
+                    0xC0DEC));
+            objects = leaves(TestBase::createLedgerEntryBatch(
+                static_cast<int>(count), 2));
+        }
+
+        // Objects compressed with a dictionary are read through the registry
+        auto const& registered = ZstdDictionary::add(dictionary);
+
+        log << objects.size() << " objects, dictionary " << registered.id()
+            << " of " << registered.content().size() << " bytes" << std::endl;
+        report("lz4", objects, nullptr);
+        report("zstd", objects, &registered);
+    }
+};
+
+BEAST_DEFINE_TESTSUITE_MANUAL(CodecTiming, nodestore, ripple);
+
+}  // namespace NodeStore
+}  // namespace ripple
@@ -29,6 +29,9 @@
 
 #include <xrpl/beast/utility/temp_dir.h>
 
+#include <chrono>
+#include <thread>
+
 namespace ripple {
 
 namespace NodeStore {
@@ -732,6 +735,171 @@ public:
 
     //--------------------------------------------------------------------------
 
+    void
+    testHotTier(std::int64_t const seedValue)
+    {
+        testcase("Hot tier");
+
+        DummyScheduler scheduler;
+
+        beast::temp_dir node_db;
+        Section nodeParams;
+        nodeParams.set("type", "memory");
+        nodeParams.set("path", node_db.path());
+        nodeParams.set("hot_ledgers", "4");
+        // Without a cache, every read reaches one of the tiers
+        nodeParams.set("cache_size", "0");
+        nodeParams.set("cache_age", "0");
+
+        std::unique_ptr<Database> db = Manager::instance().make_Database(
+            megabytes(4), scheduler, 2, nodeParams, journal_);
+
+        beast::xor_shift_engine rng(seedValue);
+        auto const older = createPredictableBatch(500, rng());
+        auto const newer = createPredictableBatch(500, rng());
+
+        auto const store = [&](Batch const& batch, std::uint32_t ledgerSeq) {
+            for (auto const& object : batch)
+            {
+                db->store(
+                    object->getType(),
+                    Blob(object->getData()),
+                    object->getHash(),
+                    ledgerSeq);
+            }
+        };
+
+        auto const counts = [&]() {
+            Json::Value obj(Json::objectValue);
+            db->getCountsJson(obj);
+            return obj;
+        };
+
+        auto const expectCount = [&](char const* name, std::size_t n) {
+            BEAST_EXPECTS(
+                counts()[name].asString() == std::to_string(n), name);
+        };
+
+        store(older, 10);
+        db->sync();
+
+        {
+            // The objects are read from the hot tier
+            Batch copy;
+            fetchCopyOfBatch(*db, &copy, older);
+            BEAST_EXPECT(areBatchesEqual(older, copy));
+            expectCount("node_hot_objects", older.size());
+            expectCount("node_reads_hot_hit", older.size());
+            expectCount("node_reads_cold", 0);
+        }
+
+        // Nothing is evicted while the ledger is still held
+        store(newer, 13);
+        db->sweep();
+        expectCount("node_hot_evictions", 0);
+
+        // The older ledger is no longer among the last four
+        store(newer, 14);
+        db->sync();
+        db->sweep();
+        expectCount("node_hot_evictions", older.size());
+        expectCount("node_hot_objects", newer.size());
+
+        {
+            // The evicted objects are read from the cold tier
+            Batch copy;
+            fetchCopyOfBatch(*db, &copy, older);
+            BEAST_EXPECT(areBatchesEqual(older, copy));
+            expectCount("node_reads_cold", older.size());
+            expectCount("node_reads_cold_hit", older.size());
+        }
+
+        {
+            // While the newer objects are still in the hot tier
+            Batch copy;
+            fetchCopyOfBatch(*db, &copy, newer);
+            BEAST_EXPECT(areBatchesEqual(newer, copy));
+            expectCount(
+                "node_reads_hot_hit", older.size() + newer.size());
+            expectCount("node_reads_cold", older.size());
+        }
+    }
+
+    //--------------------------------------------------------------------------
+
+    void
+    testKeyFilter(std::string const& type, std::int64_t const seedValue)
+    {
+        testcase("Key filter with backend '" + type + "'");
+
+        DummyScheduler scheduler;
+
+        beast::temp_dir node_db;
+        Section nodeParams;
+        nodeParams.set("type", type);
+        nodeParams.set("path", node_db.path());
+        // Without a cache, every read reaches the filter
+        nodeParams.set("cache_size", "0");
+        nodeParams.set("cache_age", "0");
+
+        beast::xor_shift_engine rng(seedValue);
+        auto const stored = createPredictableBatch(1000, rng());
+        auto const missing = createPredictableBatch(1000, rng());
+
+        {
+            std::unique_ptr<Database> db = Manager::instance().make_Database(
+                megabytes(4), scheduler, 2, nodeParams, journal_);
+            storeBatch(*db, stored);
+        }
+
+        // Reopen the database with a filter, which is built from the objects
+        // already stored
+        nodeParams.set("key_filter_size", "2000");
+        std::unique_ptr<Database> db = Manager::instance().make_Database(
+            megabytes(4), scheduler, 2, nodeParams, journal_);
+
+        auto const count = [&](char const* name) {
+            Json::Value obj(Json::objectValue);
+            db->getCountsJson(obj);
+            return std::stoull(obj[name].asString());
+        };
+
+        // The filter is only consulted once it has every key in the backend,
+        // which some backends add in the background
+        for (int i = 0; i < 500 && count("node_filter_ready") == 0; ++i)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        BEAST_EXPECT(count("node_filter_ready") == 1);
+
+        {
+            Batch copy;
+            fetchCopyOfBatch(*db, &copy, stored);
+            BEAST_EXPECT(areBatchesEqual(stored, copy));
+            BEAST_EXPECT(count("node_filter_negatives") == 0);
+        }
+
+        {
+            // Nearly every missing object is answered by the filter
+            Batch copy;
+            fetchCopyOfBatch(*db, &copy, missing);
+            BEAST_EXPECT(copy.empty());
+            auto const negatives = count("node_filter_negatives");
+            BEAST_EXPECT(
+                negatives + count("node_filter_false_positives") ==
+                missing.size());
+            BEAST_EXPECT(negatives >= missing.size() * 9 / 10);
+        }
+
+        {
+            // Objects stored later are added to the filter
+            storeBatch(*db, missing);
+            Batch copy;
+            fetchCopyOfBatch(*db, &copy, missing);
+            BEAST_EXPECT(areBatchesEqual(missing, copy));
+        }
+    }
+
+    //--------------------------------------------------------------------------
+
     void
     run() override
     {
@@ -741,6 +909,11 @@ public:
 
         testNodeStore("memory", false, seedValue);
 
+        testHotTier(seedValue);
+
+        testKeyFilter("memory", seedValue);
+        testKeyFilter("nudb", seedValue);
+
         // Persistent backend tests
         {
             testNodeStore("nudb", true, seedValue);
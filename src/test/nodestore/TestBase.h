@@ -23,16 +23,22 @@
 #include <xrpld/nodestore/Backend.h>
 #include <xrpld/nodestore/Database.h>
 #include <xrpld/nodestore/Types.h>
+#include <xrpld/nodestore/detail/EncodedBlob.h>
 
 #include <xrpl/basics/StringUtilities.h>
 #include <xrpl/basics/random.h>
 #include <xrpl/beast/unit_test.h>
 #include <xrpl/beast/utility/rngfill.h>
 #include <xrpl/beast/xor_shift_engine.h>
+#include <xrpl/protocol/HashPrefix.h>
+#include <xrpl/protocol/Indexes.h>
+#include <xrpl/protocol/STLedgerEntry.h>
+#include <xrpl/protocol/Serializer.h>
 
 #include <boost/algorithm/string.hpp>
 
 #include <iomanip>
+#include <optional>
 
 namespace ripple {
 namespace NodeStore {
@@ -118,6 +124,66 @@ public:
         return batch;
     }
 
+    // Create a predictable batch of account root leaf nodes. Unlike random
+    // payloads, these share structure the way the objects of a real ledger
+    // do, so they are useful to exercise compression.
+    static Batch
+    createLedgerEntryBatch(int numObjects, std::uint64_t seed)
+    {
+        Batch batch;
+        batch.reserve(numObjects);
+
+        beast::xor_shift_engine rng(seed);
+
+        for (int i = 0; i < numObjects; ++i)
+        {
+            AccountID account;
+            beast::rngfill(account.begin(), account.size(), rng);
+            uint256 txID;
+            beast::rngfill(txID.begin(), txID.size(), rng);
+
+            auto const keylet = keylet::account(account);
+            STLedgerEntry sle(keylet);
+            sle.setAccountID(sfAccount, account);
+            sle.setFieldAmount(
+                sfBalance, STAmount{rand_int(rng, 100'000'000'000ull)});
+            sle.setFieldU32(sfSequence, rand_int(rng, 1u, 1u << 26));
+            sle.setFieldU32(sfOwnerCount, rand_int(rng, 10u));
+            sle.setFieldH256(sfPreviousTxnID, txID);
+            sle.setFieldU32(sfPreviousTxnLgrSeq, rand_int(rng, 1u, 1u << 26));
+
+            Serializer s;
+            s.add32(HashPrefix::leafNode);
+            sle.add(s);
+            s.addBitString(keylet.key);
+
+            uint256 hash;
+            beast::rngfill(hash.begin(), hash.size(), rng);
+
+            batch.push_back(NodeObject::createObject(
+                hotACCOUNT_NODE, std::move(s.modData()), hash));
+        }
+
+        return batch;
+    }
+
+    // Returns the bytes a backend compresses to store an object, or nothing
+    // for an inner node, which is stored by the inner node codec instead.
+    static std::optional<Blob>
+    encodeLeaf(std::shared_ptr<NodeObject> const& object)
+    {
+        auto const& data = object->getData();
+        if (data.size() == 516 &&
+            (std::uint32_t{data[0]} << 24 | std::uint32_t{data[1]} << 16 |
+             std::uint32_t{data[2]} << 8 | data[3]) ==
+                static_cast<std::uint32_t>(HashPrefix::innerNode))
+            return std::nullopt;
+
+        EncodedBlob const e(object);
+        auto const p = static_cast<std::uint8_t const*>(e.getData());
+        return Blob(p, p + e.getSize());
+    }
+
     // Compare two batches for equality
     static bool
     areBatchesEqual(Batch const& lhs, Batch const& rhs)
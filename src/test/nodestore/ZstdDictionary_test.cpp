@@ -0,0 +1,267 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <test/nodestore/TestBase.h>
+#include <test/unit_test/SuiteJournal.h>
+
+#include <xrpld/core/ZstdDictionary.h>
+#include <xrpld/nodestore/DummyScheduler.h>
+#include <xrpld/nodestore/Manager.h>
+#include <xrpld/nodestore/detail/codec.h>
+
+#include <xrpl/basics/BasicConfig.h>
+#include <xrpl/basics/ByteUtilities.h>
+#include <xrpl/basics/FileUtilities.h>
+#include <xrpl/beast/utility/temp_dir.h>
+
+#include <nudb/detail/buffer.hpp>
+
+#include <cstring>
+#include <string>
+
+namespace ripple {
+namespace NodeStore {
+
+class ZstdDictionary_test : public TestBase
+{
+    static std::vector<Blob>
+    samples(Batch const& batch)
+    {
+        std::vector<Blob> result;
+        for (auto const& object : batch)
+        {
+            if (auto blob = encodeLeaf(object))
+                result.push_back(std::move(*blob));
+        }
+        return result;
+    }
+
+    static std::shared_ptr<ZstdDictionary const>
+    makeDictionary(std::uint32_t id, std::uint64_t seed)
+    {
+        return std::make_shared<ZstdDictionary const>(ZstdDictionary::train(
+            samples(createLedgerEntryBatch(2000, seed)), kilobytes(16), id));
+    }
+
+    void
+    testTrain()
+    {
+        testcase("train");
+
+        auto const dictionary = makeDictionary(1001, 1);
+        BEAST_EXPECT(dictionary->id() == 1001);
+        BEAST_EXPECT(dictionary->content().size() <= kilobytes(16));
+
+        auto const throws = [](auto&& f) {
+            try
+            {
+                f();
+            }
+            catch (std::runtime_error const&)
+            {
+                return true;
+            }
+            return false;
+        };
+
+        // Every dictionary needs an ID
+        BEAST_EXPECT(throws([] {
+            ZstdDictionary::train(
+                samples(createLedgerEntryBatch(2000, 1)), kilobytes(16), 0);
+        }));
+
+        // Too few samples to train on
+        BEAST_EXPECT(throws([] {
+            ZstdDictionary::train(
+                samples(createLedgerEntryBatch(2, 1)), kilobytes(16), 1);
+        }));
+
+        // Not a dictionary
+        BEAST_EXPECT(throws([] { ZstdDictionary(Blob(1000, 7)); }));
+    }
+
+    void
+    testRegistry()
+    {
+        testcase("registry");
+
+        auto const dictionary = makeDictionary(1002, 2);
+        BEAST_EXPECT(!ZstdDictionary::find(1002));
+        BEAST_EXPECT(&ZstdDictionary::add(dictionary) == dictionary.get());
+        BEAST_EXPECT(ZstdDictionary::find(1002) == dictionary.get());
+
+        // The same dictionary again is fine, but not another with its ID
+        auto const copy = std::make_shared<ZstdDictionary const>(
+            Blob(dictionary->content().begin(), dictionary->content().end()));
+        BEAST_EXPECT(&ZstdDictionary::add(copy) == dictionary.get());
+        try
+        {
+            ZstdDictionary::add(makeDictionary(1002, 3));
+            fail();
+        }
+        catch (std::runtime_error const&)
+        {
+            pass();
+        }
+        BEAST_EXPECT(ZstdDictionary::find(1002) == dictionary.get());
+    }
+
+    void
+    testCodec()
+    {
+        testcase("codec");
+
+        auto const& dictionary = ZstdDictionary::add(makeDictionary(1003, 4));
+
+        auto const roundTrip = [&](Blob const& blob,
+                                   ZstdDictionary const* dictionary) {
+            nudb::detail::buffer bf1;
+            nudb::detail::buffer bf2;
+            auto const compressed = nodeobject_compress(
+                blob.data(), blob.size(), bf1, dictionary);
+            auto const decompressed = nodeobject_decompress(
+                compressed.first, compressed.second, bf2);
+            BEAST_EXPECT(
+                decompressed.second == blob.size() &&
+                std::memcmp(decompressed.first, blob.data(), blob.size()) ==
+                    0);
+            return std::make_pair(
+                *static_cast<std::uint8_t const*>(compressed.first),
+                compressed.second);
+        };
+
+        // Ledger entries compress better with the dictionary
+        std::size_t lz4 = 0;
+        std::size_t zstd = 0;
+        for (auto const& blob : samples(createLedgerEntryBatch(1000, 5)))
+        {
+            auto const [type, size] = roundTrip(blob, &dictionary);
+            BEAST_EXPECT(type == 4);
+            zstd += size;
+            lz4 += roundTrip(blob, nullptr).second;
+        }
+        BEAST_EXPECT(zstd < lz4);
+
+        // Data unlike the samples survives too
+        for (auto const& object : createPredictableBatch(100, 6))
+            roundTrip(*encodeLeaf(object), &dictionary);
+
+        // Inner nodes are still stored by the inner node codec
+        {
+            Serializer s;
+            s.add32(HashPrefix::innerNode);
+            for (int i = 0; i < 16; ++i)
+                s.addBitString(i % 2 ? uint256{} : uint256{i + 1u});
+            auto const inner = NodeObject::createObject(
+                hotUNKNOWN, std::move(s.modData()), uint256{1});
+            BEAST_EXPECT(!encodeLeaf(inner));
+            EncodedBlob const e(inner);
+            auto const p = static_cast<std::uint8_t const*>(e.getData());
+            BEAST_EXPECT(
+                roundTrip(Blob(p, p + e.getSize()), &dictionary).first == 2);
+        }
+
+        // A dictionary that isn't registered can't be read
+        {
+            auto const unknown = makeDictionary(1004, 7);
+            auto const blob = samples(createLedgerEntryBatch(1, 8)).front();
+            nudb::detail::buffer bf1;
+            nudb::detail::buffer bf2;
+            auto const compressed = nodeobject_compress(
+                blob.data(), blob.size(), bf1, unknown.get());
+            try
+            {
+                nodeobject_decompress(compressed.first, compressed.second, bf2);
+                fail();
+            }
+            catch (std::runtime_error const&)
+            {
+                pass();
+            }
+        }
+    }
+
+    void
+    testBackend()
+    {
+        testcase("backend");
+
+        beast::temp_dir td;
+        test::SuiteJournal journal("ZstdDictionary_test", *this);
+
+        // An earlier dictionary kept alongside the current one
+        auto const write = [&](std::string const& name,
+                               std::uint32_t id,
+                               std::uint64_t seed) {
+            auto const content = makeDictionary(id, seed)->content();
+            boost::system::error_code ec;
+            writeFileContents(
+                ec,
+                td.file(name),
+                std::string(content.begin(), content.end()));
+            BEAST_EXPECT(!ec);
+        };
+        write("nodes_1005.zdict", 1005, 9);
+        write("nodes_1006.zdict", 1006, 10);
+
+        Section params;
+        params.set("type", "nudb");
+        params.set("path", td.file("nudb"));
+        params.set("compression_dictionary", td.file("nodes_1006.zdict"));
+
+        DummyScheduler scheduler;
+        auto backend = Manager::instance().make_Backend(
+            params, megabytes(4), scheduler, journal);
+        BEAST_EXPECT(ZstdDictionary::find(1005));
+        BEAST_EXPECT(ZstdDictionary::find(1006));
+
+        backend->open();
+        auto const batch = createLedgerEntryBatch(numObjectsToTest, 11);
+        storeBatch(*backend, batch);
+
+        Batch copy;
+        fetchCopyOfBatch(*backend, &copy, batch);
+        BEAST_EXPECT(areBatchesEqual(batch, copy));
+
+        copy.clear();
+        backend->for_each([&](std::shared_ptr<NodeObject> object) {
+            copy.push_back(object);
+        });
+        std::sort(copy.begin(), copy.end(), LessThan{});
+        auto sorted = batch;
+        std::sort(sorted.begin(), sorted.end(), LessThan{});
+        BEAST_EXPECT(areBatchesEqual(sorted, copy));
+        backend->close();
+    }
+
+public:
+    void
+    run() override
+    {
+        testTrain();
+        testRegistry();
+        testCodec();
+        testBackend();
+    }
+};
+
+BEAST_DEFINE_TESTSUITE(ZstdDictionary, nodestore, ripple);
+
+}  // namespace NodeStore
+}  // namespace ripple
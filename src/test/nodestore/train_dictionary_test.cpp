@@ -0,0 +1,130 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <test/nodestore/TestBase.h>
+#include <test/unit_test/SuiteJournal.h>
+
+#include <xrpld/core/ZstdDictionary.h>
+#include <xrpld/nodestore/DummyScheduler.h>
+#include <xrpld/nodestore/Manager.h>
+
+#include <xrpl/basics/BasicConfig.h>
+#include <xrpl/basics/ByteUtilities.h>
+#include <xrpl/basics/FileUtilities.h>
+#include <xrpl/beast/core/LexicalCast.h>
+#include <xrpl/beast/xor_shift_engine.h>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/filesystem.hpp>
+
+#include <string>
+#include <vector>
+
+namespace ripple {
+namespace NodeStore {
+
+// Trains a zstd dictionary on the objects of an existing node store, for
+// the compression_dictionary setting of a NuDB backend. The objects are
+// sampled uniformly from the whole store.
+class train_dictionary_test : public beast::unit_test::suite
+{
+public:
+    void
+    run() override
+    {
+        testcase(beast::unit_test::abort_on_fail) << arg();
+        pass();
+
+        Section args;
+        {
+            std::vector<std::string> v;
+            boost::split(v, arg(), boost::algorithm::is_any_of(","));
+            args.append(v);
+        }
+
+        std::string to;
+        std::uint32_t id = 0;
+        if (!args.exists("path") || !get_if_exists(args, "to", to) ||
+            !get_if_exists(args, "id", id) || id == 0)
+        {
+            log << "Usage:\n"
+                << "--unittest-arg=path=<path>,to=<file>,id=<id>"
+                   "[,type=<type>][,samples=<n>][,size=<bytes>]\n"
+                << "path:    Node store to sample, which must not be in use\n"
+                << "to:      Dictionary file to write\n"
+                << "id:      Non-zero ID of the dictionary, which must differ "
+                   "from the IDs of all\n"
+                << "         earlier dictionaries used with the store\n"
+                << "type:    Type of the node store, default NuDB\n"
+                << "samples: Objects to train on, default 100000\n"
+                << "size:    Largest size of the dictionary, default 65536";
+            return;
+        }
+        if (!args.exists("type"))
+            args.set("type", "NuDB");
+        auto const count = get<std::size_t>(args, "samples", 100'000);
+        auto const size = get<std::size_t>(args, "size", kilobytes(64));
+
+        if (boost::filesystem::exists(to))
+        {
+            log << "Not overwriting " << to;
+            return;
+        }
+
+        test::SuiteJournal journal("train_dictionary", *this);
+        DummyScheduler scheduler;
+        auto backend = Manager::instance().make_Backend(
+            args, megabytes(4), scheduler, journal);
+        backend->open(false);
+
+        // Reservoir sampling, so every leaf is equally likely to be chosen
+        std::vector<Blob> samples;
+        samples.reserve(count);
+        std::size_t seen = 0;
+        beast::xor_shift_engine rng(id);
+        backend->for_each([&](std::shared_ptr<NodeObject> object) {
+            auto blob = TestBase::encodeLeaf(object);
+            if (!blob)
+                return;
+            if (samples.size() < count)
+                samples.push_back(std::move(*blob));
+            else if (auto const i = rand_int(rng, seen); i < count)
+                samples[i] = std::move(*blob);
+            ++seen;
+        });
+        backend->close();
+
+        log << "Training on " << samples.size() << " of " << seen
+            << " leaf objects";
+        auto const content = ZstdDictionary::train(samples, size, id);
+
+        boost::system::error_code ec;
+        writeFileContents(ec, to, std::string(content.begin(), content.end()));
+        if (ec)
+            Throw<std::runtime_error>(
+                "Can't write " + to + ": " + ec.message());
+        log << "Wrote dictionary " << id << " of " << content.size()
+            << " bytes to " << to;
+    }
+};
+
+BEAST_DEFINE_TESTSUITE_MANUAL(train_dictionary, nodestore, ripple);
+
+}  // namespace NodeStore
+}  // namespace ripple
@@ -37,6 +37,8 @@
 #include <xrpl/beast/utility/Journal.h>
 #include <xrpl/protocol/HashPrefix.h>
 #include <xrpl/protocol/PublicKey.h>
+#include <xrpl/protocol/STTx.h>
+#include <xrpl/protocol/STValidation.h>
 #include <xrpl/protocol/SecretKey.h>
 #include <xrpl/protocol/Sign.h>
 #include <xrpl/protocol/digest.h>
@@ -48,6 +50,8 @@
 #include <boost/endian/conversion.hpp>
 
 #include <algorithm>
+#include <chrono>
+#include <map>
 
 namespace ripple {
 
@@ -77,6 +81,19 @@ class compression_test : public beast::unit_test::suite
     using Compressed = compression::Compressed;
     using Algorithm = compression::Algorithm;
 
+    struct Validator
+    {
+        PublicKey publicKey;
+        SecretKey secretKey;
+        std::uint64_t cookie;
+    };
+
+    // A network's validations and proposals come from the same validators
+    // ledger after ledger, as do most of its transactions from the same
+    // accounts, so a dictionary trained on its traffic learns their keys.
+    std::vector<Validator> validators_;
+    std::vector<std::pair<PublicKey, SecretKey>> accounts_;
+
 public:
     compression_test()
     {
@@ -88,13 +105,16 @@ public:
         std::shared_ptr<T> proto,
         protocol::MessageType mt,
         uint16_t nbuffers,
-        std::string msg)
+        std::string msg,
+        ZstdDictionary const* dictionary = nullptr)
     {
-        testcase("Compress/Decompress: " + msg);
+        testcase(
+            std::string("Compress/Decompress") +
+            (dictionary ? " zstd: " : ": ") + msg);
 
         Message m(*proto, mt);
 
-        auto& buffer = m.getBuffer(Compressed::On);
+        auto& buffer = m.getBuffer(Compressed::On, dictionary);
 
         boost::beast::multi_buffer buffers;
 
@@ -116,9 +136,17 @@ public:
 
         BEAST_EXPECT(header);
 
+        // With a dictionary, even the smallest messages compress
+        if (dictionary)
+            BEAST_EXPECT(header && header->algorithm == Algorithm::Zstd);
+
         if (!header || header->algorithm == Algorithm::None)
             return;
 
+        BEAST_EXPECT(
+            header->algorithm ==
+            (dictionary ? Algorithm::Zstd : Algorithm::LZ4));
+
         std::vector<std::uint8_t> decompressed;
         decompressed.resize(header->uncompressed_size);
 
@@ -132,7 +160,9 @@ public:
             stream,
             header->payload_wire_size,
             decompressed.data(),
-            header->uncompressed_size);
+            header->uncompressed_size,
+            header->algorithm,
+            dictionary);
         BEAST_EXPECT(decompressedSize == header->uncompressed_size);
         auto const proto1 = std::make_shared<T>();
 
@@ -385,6 +415,139 @@ public:
         return list;
     }
 
+    void
+    makeNetwork(std::size_t validators, std::size_t accounts)
+    {
+        validators_.clear();
+        for (std::size_t i = 0; i < validators; ++i)
+        {
+            auto [publicKey, secretKey] = randomKeyPair(KeyType::secp256k1);
+            validators_.push_back(
+                {publicKey, secretKey, rand_int<std::uint64_t>()});
+        }
+
+        accounts_.clear();
+        for (std::size_t i = 0; i < accounts; ++i)
+            accounts_.push_back(randomKeyPair(KeyType::secp256k1));
+    }
+
+    std::shared_ptr<protocol::TMValidation>
+    buildValidation(Validator const& validator, std::uint32_t seq)
+    {
+        auto const v = std::make_shared<STValidation>(
+            NetClock::time_point{std::chrono::seconds{4 * seq}},
+            validator.publicKey,
+            validator.secretKey,
+            calcNodeID(validator.publicKey),
+            [&](STValidation& v) {
+                v.setFieldH256(sfLedgerHash, sha512Half(seq));
+                v.setFieldH256(sfConsensusHash, sha512Half(seq, 1));
+                v.setFieldU32(sfLedgerSequence, seq);
+                v.setFlag(vfFullValidation);
+                v.setFieldH256(sfValidatedHash, sha512Half(seq - 1));
+                v.setFieldU64(sfCookie, validator.cookie);
+            });
+
+        auto const serialized = v->getSerialized();
+        auto validation = std::make_shared<protocol::TMValidation>();
+        validation->set_validation(serialized.data(), serialized.size());
+        return validation;
+    }
+
+    std::shared_ptr<protocol::TMProposeSet>
+    buildProposal(Validator const& validator, std::uint32_t seq)
+    {
+        std::uint32_t const proposeSeq = 0;
+        std::uint32_t const closeTime = 4 * seq;
+        uint256 const position = sha512Half(seq, 1);
+        uint256 const prevLedger = sha512Half(seq - 1);
+        auto const signature = signDigest(
+            validator.publicKey,
+            validator.secretKey,
+            sha512Half(
+                HashPrefix::proposal,
+                proposeSeq,
+                closeTime,
+                prevLedger,
+                position));
+
+        auto proposal = std::make_shared<protocol::TMProposeSet>();
+        proposal->set_proposeseq(proposeSeq);
+        proposal->set_closetime(closeTime);
+        proposal->set_currenttxhash(position.data(), position.size());
+        proposal->set_previousledger(prevLedger.data(), prevLedger.size());
+        proposal->set_nodepubkey(
+            validator.publicKey.data(), validator.publicKey.size());
+        proposal->set_signature(signature.data(), signature.size());
+        return proposal;
+    }
+
+    std::shared_ptr<protocol::TMTransaction>
+    buildPayment(std::size_t from, std::size_t to, std::uint32_t seq)
+    {
+        auto const& [publicKey, secretKey] = accounts_[from];
+        STTx tx(ttPAYMENT, [&](STObject& obj) {
+            obj.setAccountID(sfAccount, calcAccountID(publicKey));
+            obj.setAccountID(
+                sfDestination, calcAccountID(accounts_[to].first));
+            obj.setFieldAmount(
+                sfAmount, XRPAmount(rand_int<std::int64_t>(1, 1'000'000'000)));
+            obj.setFieldAmount(sfFee, XRPAmount(12));
+            obj.setFieldU32(sfSequence, seq);
+            obj.setFieldU32(sfLastLedgerSequence, seq + 4);
+            obj.setFieldVL(sfSigningPubKey, publicKey.slice());
+        });
+        tx.sign(publicKey, secretKey);
+
+        Serializer s;
+        tx.add(s);
+        auto transaction = std::make_shared<protocol::TMTransaction>();
+        transaction->set_rawtransaction(s.data(), s.size());
+        transaction->set_status(protocol::tsNEW);
+        transaction->set_receivetimestamp(rand_int<std::uint64_t>());
+        return transaction;
+    }
+
+    // The serialized validations, proposals and transactions of each ledger
+    // in a range, by message type.
+    std::map<std::string, std::vector<Blob>>
+    buildTraffic(std::uint32_t firstSeq, std::uint32_t ledgers)
+    {
+        auto const serialize = [](::google::protobuf::Message const& m) {
+            Blob blob(Message::messageSize(m));
+            m.SerializeToArray(blob.data(), blob.size());
+            return blob;
+        };
+
+        std::map<std::string, std::vector<Blob>> traffic;
+        for (auto seq = firstSeq; seq != firstSeq + ledgers; ++seq)
+        {
+            for (auto const& validator : validators_)
+            {
+                traffic["TMValidation"].push_back(
+                    serialize(*buildValidation(validator, seq)));
+                traffic["TMProposeSet"].push_back(
+                    serialize(*buildProposal(validator, seq)));
+            }
+            for (std::size_t i = 0; i < accounts_.size(); ++i)
+            {
+                traffic["TMTransaction"].push_back(serialize(*buildPayment(
+                    i, rand_int<std::size_t>(accounts_.size() - 1), seq)));
+            }
+        }
+        return traffic;
+    }
+
+    std::shared_ptr<ZstdDictionary const>
+    trainDictionary(std::uint32_t firstSeq, std::uint32_t ledgers, int id)
+    {
+        std::vector<Blob> samples;
+        for (auto& [type, messages] : buildTraffic(firstSeq, ledgers))
+            samples.insert(samples.end(), messages.begin(), messages.end());
+        return std::make_shared<ZstdDictionary const>(
+            ZstdDictionary::train(samples, 16 * 1024, id));
+    }
+
     void
     testProtocol()
     {
@@ -463,6 +626,34 @@ public:
             protocol::mtVALIDATORLISTCOLLECTION,
             4,
             "TMValidatorListCollection");
+
+        // zstd, with a dictionary trained on the traffic of earlier ledgers
+        makeNetwork(35, 100);
+        auto const dictionary = trainDictionary(1, 10, 1);
+        doTest(
+            buildValidation(validators_.front(), 11),
+            protocol::mtVALIDATION,
+            1,
+            "TMValidation",
+            dictionary.get());
+        doTest(
+            buildProposal(validators_.front(), 11),
+            protocol::mtPROPOSE_LEDGER,
+            1,
+            "TMProposeSet",
+            dictionary.get());
+        doTest(
+            buildPayment(0, 1, 11),
+            protocol::mtTRANSACTION,
+            2,
+            "TMTransaction",
+            dictionary.get());
+        doTest(
+            buildLedgerData(500, *logs),
+            protocol::mtLEDGER_DATA,
+            10,
+            "TMLedgerData500",
+            dictionary.get());
     }
 
     void
@@ -491,6 +682,7 @@ public:
             auto request = ripple::makeRequest(
                 true,
                 env->app().config().COMPRESSION,
+                {},
                 false,
                 env->app().config().TX_REDUCE_RELAY_ENABLE,
                 env->app().config().VP_REDUCE_RELAY_BASE_SQUELCH_ENABLE);
@@ -516,6 +708,7 @@ public:
                 uint256{1},
                 1,
                 {1, 0},
+                {},
                 env->app());
             // outbound is enabled if the response's header has the feature
             // enabled and the peer's configuration is enabled
@@ -529,11 +722,159 @@ public:
         handshake(0, 0);
     }
 
+    void
+    testHandshakeZstd()
+    {
+        testcase("Handshake zstd");
+
+        makeNetwork(4, 10);
+        auto const d1 = trainDictionary(1, 10, 1);
+        auto const d2 = trainDictionary(11, 10, 2);
+
+        // Returns the dictionaries each side chooses, which must be the same
+        auto handshake = [&](bool outboundEnable,
+                             compression::Dictionaries const& outbound,
+                             bool inboundEnable,
+                             compression::Dictionaries const& inbound) {
+            auto request = ripple::makeRequest(
+                true, outboundEnable, outbound, false, false, false);
+            http_request_type http_request;
+            http_request.version(request.version());
+            http_request.base() = request.base();
+            auto const inboundDictionary =
+                peerDictionary(http_request, inbound, inboundEnable);
+
+            http_response_type http_resp;
+            http_resp.insert(
+                "X-Protocol-Ctl",
+                makeFeaturesResponseHeader(
+                    http_request,
+                    inboundEnable,
+                    inbound,
+                    false,
+                    false,
+                    false));
+            auto const outboundDictionary =
+                peerDictionary(http_resp, outbound, outboundEnable);
+
+            BEAST_EXPECT(
+                (inboundDictionary ? inboundDictionary->id() : 0) ==
+                (outboundDictionary ? outboundDictionary->id() : 0));
+            return outboundDictionary ? outboundDictionary->id() : 0;
+        };
+
+        // The newest dictionary both sides have
+        BEAST_EXPECT(handshake(true, {d2, d1}, true, {d2, d1}) == 2);
+        BEAST_EXPECT(handshake(true, {d2, d1}, true, {d1}) == 1);
+        BEAST_EXPECT(handshake(true, {d1}, true, {d2, d1}) == 1);
+        // No dictionary in common, or compression disabled
+        BEAST_EXPECT(handshake(true, {d2}, true, {d1}) == 0);
+        BEAST_EXPECT(handshake(true, {}, true, {d1}) == 0);
+        BEAST_EXPECT(handshake(true, {d1}, true, {}) == 0);
+        BEAST_EXPECT(handshake(false, {d1}, true, {d1}) == 0);
+        BEAST_EXPECT(handshake(true, {d1}, false, {d1}) == 0);
+    }
+
+    // Reports the compression ratio and the time to compress and decompress
+    // each message type with LZ4, and with zstd and a dictionary trained on
+    // the traffic of earlier ledgers.
+    void
+    testRatio()
+    {
+        testcase("Ratio");
+
+        using clock = std::chrono::steady_clock;
+        auto const ns = [](clock::duration d, std::size_t n) {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(d)
+                       .count() /
+                static_cast<double>(n);
+        };
+
+        makeNetwork(35, 100);
+        auto const dictionary = trainDictionary(1, 20, 1);
+        log << "dictionary: " << dictionary->content().size() << " bytes"
+            << std::endl;
+
+        for (auto const& [type, messages] : buildTraffic(21, 20))
+        {
+            std::size_t bytes = 0;
+            std::size_t lz4Bytes = 0;
+            std::size_t zstdBytes = 0;
+            std::vector<Blob> lz4(messages.size());
+            std::vector<Blob> zstd(messages.size());
+
+            auto start = clock::now();
+            for (std::size_t i = 0; i < messages.size(); ++i)
+            {
+                auto const size = compression::compress(
+                    messages[i].data(), messages[i].size(), [&](std::size_t n) {
+                        lz4[i].resize(n);
+                        return lz4[i].data();
+                    });
+                lz4[i].resize(size);
+                lz4Bytes += size;
+                bytes += messages[i].size();
+            }
+            auto const lz4Compress = clock::now() - start;
+
+            start = clock::now();
+            for (std::size_t i = 0; i < messages.size(); ++i)
+            {
+                auto const size = compression::compress(
+                    messages[i].data(),
+                    messages[i].size(),
+                    [&](std::size_t n) {
+                        zstd[i].resize(n);
+                        return zstd[i].data();
+                    },
+                    Algorithm::Zstd,
+                    dictionary.get());
+                zstd[i].resize(size);
+                zstdBytes += size;
+            }
+            auto const zstdCompress = clock::now() - start;
+
+            Blob out;
+            start = clock::now();
+            for (std::size_t i = 0; i < messages.size(); ++i)
+            {
+                out.resize(messages[i].size());
+                compression_algorithms::lz4Decompress(
+                    lz4[i].data(), lz4[i].size(), out.data(), out.size());
+            }
+            auto const lz4Decompress = clock::now() - start;
+
+            start = clock::now();
+            for (std::size_t i = 0; i < messages.size(); ++i)
+            {
+                out.resize(messages[i].size());
+                dictionary->decompress(
+                    zstd[i].data(), zstd[i].size(), out.data(), out.size());
+                BEAST_EXPECT(out == messages[i]);
+            }
+            auto const zstdDecompress = clock::now() - start;
+
+            auto const n = messages.size();
+            log << type << ": " << n << " messages, " << bytes / n
+                << " bytes each" << std::endl
+                << "  lz4: ratio "
+                << static_cast<double>(bytes) / lz4Bytes << ", compress "
+                << ns(lz4Compress, n) << " ns, decompress "
+                << ns(lz4Decompress, n) << " ns" << std::endl
+                << "  zstd: ratio "
+                << static_cast<double>(bytes) / zstdBytes << ", compress "
+                << ns(zstdCompress, n) << " ns, decompress "
+                << ns(zstdDecompress, n) << " ns" << std::endl;
+        }
+    }
+
     void
     run() override
     {
         testProtocol();
         testHandshake();
+        testHandshakeZstd();
+        testRatio();
     }
 };
 
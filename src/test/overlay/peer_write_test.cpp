@@ -0,0 +1,157 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <test/jtx.h>
+#include <test/jtx/Env.h>
+
+#include <xrpld/overlay/Message.h>
+#include <xrpld/overlay/detail/OverlayImpl.h>
+#include <xrpld/overlay/detail/PeerImp.h>
+#include <xrpld/overlay/detail/Tuning.h>
+#include <xrpld/peerfinder/detail/SlotImp.h>
+
+#include <xrpl/basics/make_SSLContext.h>
+#include <xrpl/beast/unit_test.h>
+#include <xrpl/protocol/jss.h>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/ssl.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ripple {
+
+namespace test {
+
+class peer_write_test : public beast::unit_test::suite
+{
+    using socket_type = boost::asio::ip::tcp::socket;
+    using stream_type = boost::beast::ssl_stream<boost::beast::tcp_stream>;
+
+    void
+    testGatheredWrites()
+    {
+        using boost::asio::ssl::stream_base;
+
+        testcase("gathered writes");
+
+        jtx::Env env(*this);
+        auto& overlay = dynamic_cast<OverlayImpl&>(env.app().overlay());
+
+        // The peer's socket runs on an io_context of the test's own, so the
+        // messages can all be queued before any of them is written.
+        boost::asio::io_context io;
+        auto const context = make_SSLContext("");
+
+        boost::asio::ip::tcp::acceptor acceptor(
+            io, {boost::asio::ip::make_address("127.0.0.1"), 0});
+        auto stream = std::make_unique<stream_type>(socket_type(io), *context);
+        stream->next_layer().socket().connect(acceptor.local_endpoint());
+        socket_type serverSocket(io);
+        acceptor.accept(serverSocket);
+        boost::asio::ssl::stream<socket_type&> server(serverSocket, *context);
+
+        boost::system::error_code clientEc, serverEc;
+        stream->async_handshake(
+            stream_base::client,
+            [&](boost::system::error_code const& ec) { clientEc = ec; });
+        server.async_handshake(
+            stream_base::server,
+            [&](boost::system::error_code const& ec) { serverEc = ec; });
+        io.run();
+        io.restart();
+        if (!BEAST_EXPECT(!clientEc && !serverEc))
+            return;
+
+        beast::IP::Endpoint const local(
+            boost::asio::ip::make_address("172.1.2.1"));
+        beast::IP::Endpoint const remote(
+            boost::asio::ip::make_address("172.1.2.2"));
+        auto [slot, _] = overlay.peerFinder().new_inbound_slot(local, remote);
+        auto peer = std::make_shared<PeerImp>(
+            env.app(),
+            1,
+            slot,
+            http_request_type{},
+            std::get<0>(randomKeyPair(KeyType::ed25519)),
+            ProtocolVersion{1, 7},
+            overlay.resourceManager().newInboundEndpoint(remote),
+            std::move(stream),
+            overlay);
+
+        // The first message is written at once, the next maxWriteMessages
+        // in the second write, and the rest in the third
+        std::size_t const count = Tuning::maxWriteMessages + 6;
+        std::vector<std::uint8_t> expected;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            protocol::TMPing ping;
+            ping.set_type(protocol::TMPing::ptPING);
+            ping.set_seq(static_cast<std::uint32_t>(i));
+            auto const m = std::make_shared<Message>(ping, protocol::mtPING);
+            auto const& buffer = m->getBuffer(compression::Compressed::Off);
+            expected.insert(expected.end(), buffer.begin(), buffer.end());
+            peer->send(m);
+        }
+
+        auto const& stats = overlay.getWriteStats();
+        auto const writes = stats.writes.load();
+        auto const messages = stats.messages.load();
+        auto const bytes = stats.bytes.load();
+
+        io.run();
+
+        // The messages arrive whole and in order
+        std::vector<std::uint8_t> received(expected.size());
+        boost::system::error_code ec;
+        boost::asio::read(server, boost::asio::buffer(received), ec);
+        BEAST_EXPECT(!ec);
+        BEAST_EXPECT(received == expected);
+
+        BEAST_EXPECT(stats.writes.load() - writes == 3);
+        BEAST_EXPECT(stats.messages.load() - messages == count);
+        BEAST_EXPECT(stats.bytes.load() - bytes == expected.size());
+        BEAST_EXPECT(
+            peer->json()[jss::metrics][jss::total_writes] ==
+            std::to_string(3));
+        BEAST_EXPECT(
+            peer->json()[jss::metrics][jss::total_bytes_sent] ==
+            std::to_string(expected.size()));
+
+        peer.reset();
+    }
+
+public:
+    void
+    run() override
+    {
+        testGatheredWrites();
+    }
+};
+
+BEAST_DEFINE_TESTSUITE(peer_write, overlay, ripple);
+
+}  // namespace test
+}  // namespace ripple
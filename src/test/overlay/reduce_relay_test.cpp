@@ -189,6 +189,10 @@ public:
     removeTxQueue(uint256 const&) override
     {
     }
+    void
+    addTxBatch(std::shared_ptr<protocol::TMTransaction const> const&) override
+    {
+    }
 };
 
 /** Manually advanced clock. */
@@ -1661,6 +1665,7 @@ vp_base_squelch_max_selected_peers=2
                 auto request = ripple::makeRequest(
                     true,
                     env_.app().config().COMPRESSION,
+                    {},
                     false,
                     env_.app().config().TX_REDUCE_RELAY_ENABLE,
                     env_.app().config().VP_REDUCE_RELAY_BASE_SQUELCH_ENABLE);
@@ -1685,6 +1690,7 @@ vp_base_squelch_max_selected_peers=2
                     uint256{1},
                     1,
                     {1, 0},
+                    {},
                     env_.app());
                 // outbound is enabled if the response's header has the feature
                 // enabled and the peer's configuration is enabled
@@ -20,6 +20,7 @@
 #include <test/jtx.h>
 #include <test/jtx/Env.h>
 
+#include <xrpld/app/misc/HashRouter.h>
 #include <xrpld/overlay/detail/OverlayImpl.h>
 #include <xrpld/overlay/detail/PeerImp.h>
 #include <xrpld/peerfinder/detail/SlotImp.h>
@@ -27,6 +28,11 @@
 #include <xrpl/basics/make_SSLContext.h>
 #include <xrpl/beast/unit_test.h>
 
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <set>
+
 namespace ripple {
 
 namespace test {
@@ -91,6 +97,29 @@ private:
             test(false, false, 20, 101, false);
             test(false, false, 9, 10, false);
             test(false, false, 10, 9, false);
+
+            auto testWindow = [&](std::string const& window, bool success) {
+                Config c;
+                try
+                {
+                    c.loadFromString(
+                        "[reduce_relay]\ntx_batch_window=" + window + "\n");
+                    BEAST_EXPECT(
+                        success &&
+                        c.TX_BATCH_WINDOW ==
+                            std::chrono::milliseconds{std::stoi(window)});
+                }
+                catch (...)
+                {
+                    BEAST_EXPECT(!success);
+                }
+            };
+
+            testWindow("0", true);
+            testWindow("5", true);
+            testWindow("100", true);
+            testWindow("101", false);
+            testWindow("-1", false);
         });
     }
 
@@ -135,16 +164,73 @@ private:
         {
             queueTx_++;
         }
+        void
+        addTxBatch(std::shared_ptr<protocol::TMTransaction const> const&)
+            override
+        {
+            batchTx_++;
+        }
         static void
         init()
         {
             queueTx_ = 0;
             sendTx_ = 0;
+            batchTx_ = 0;
             sid_ = 0;
         }
         inline static std::size_t sid_ = 0;
         inline static std::uint16_t queueTx_ = 0;
         inline static std::uint16_t sendTx_ = 0;
+        inline static std::uint16_t batchTx_ = 0;
+    };
+
+    // Keeps a real queue of transaction hashes, and records the hashes it
+    // announces to the peer
+    class PeerTxQueueTest : public PeerTest
+    {
+    public:
+        using PeerTest::PeerTest;
+
+        void
+        send(std::shared_ptr<Message> const& m) override
+        {
+            // The type follows the size in the header
+            auto const& buffer = m->getBuffer(Compressed::Off);
+            if (((buffer[4] << 8) | buffer[5]) != protocol::mtHAVE_TRANSACTIONS)
+                return;
+
+            protocol::TMHaveTransactions ht;
+            if (!ht.ParseFromArray(
+                    buffer.data() + compression::headerBytes,
+                    buffer.size() - compression::headerBytes))
+                return;
+
+            std::lock_guard lock(mutex_);
+            announced_.emplace();
+            for (auto const& hash : ht.hashes())
+                announced_->emplace(uint256::fromVoid(hash.data()));
+            cv_.notify_all();
+        }
+        void
+        addTxQueue(uint256 const& hash) override
+        {
+            PeerImp::addTxQueue(hash);
+        }
+
+        // Returns the hashes announced, or nothing if none were in time
+        std::optional<std::set<uint256>>
+        waitAnnounced()
+        {
+            using namespace std::chrono_literals;
+            std::unique_lock lock(mutex_);
+            cv_.wait_for(lock, 5s, [this] { return announced_.has_value(); });
+            return announced_;
+        }
+
+    private:
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        std::optional<std::set<uint256>> announced_;
     };
 
     std::uint16_t lid_{0};
@@ -160,10 +246,11 @@ public:
     }
 
 private:
+    template <class PeerType>
     void
     addPeer(
         jtx::Env& env,
-        std::vector<std::shared_ptr<PeerTest>>& peers,
+        std::vector<std::shared_ptr<PeerType>>& peers,
         std::uint16_t& nDisabled)
     {
         auto& overlay = dynamic_cast<OverlayImpl&>(env.app().overlay());
@@ -171,7 +258,7 @@ private:
         (nDisabled == 0)
             ? (void)request.insert(
                   "X-Protocol-Ctl",
-                  makeFeaturesRequestHeader(false, false, true, false))
+                  makeFeaturesRequestHeader(false, {}, false, true, false))
             : (void)nDisabled--;
         auto stream_ptr = std::make_unique<stream_type>(
             socket_type(std::forward<boost::asio::io_context&>(
@@ -184,7 +271,7 @@ private:
         PublicKey key(std::get<0>(randomKeyPair(KeyType::ed25519)));
         auto consumer = overlay.resourceManager().newInboundEndpoint(remote);
         auto [slot, _] = overlay.peerFinder().new_inbound_slot(local, remote);
-        auto const peer = std::make_shared<PeerTest>(
+        auto const peer = std::make_shared<PeerType>(
             env.app(),
             slot,
             std::move(request),
@@ -213,7 +300,9 @@ private:
         std::uint16_t relayPercentage,
         std::uint16_t expectRelay,
         std::uint16_t expectQueue,
-        std::set<Peer::id_t> const& toSkip = {})
+        std::set<Peer::id_t> const& toSkip = {},
+        std::chrono::milliseconds batchWindow = {},
+        std::uint16_t expectBatch = 0)
     {
         testcase(test);
         jtx::Env env(*this);
@@ -221,6 +310,7 @@ private:
         env.app().config().TX_REDUCE_RELAY_ENABLE = txRREnabled;
         env.app().config().TX_REDUCE_RELAY_MIN_PEERS = minPeers;
         env.app().config().TX_RELAY_PERCENTAGE = relayPercentage;
+        env.app().config().TX_BATCH_WINDOW = batchWindow;
         PeerTest::init();
         lid_ = 0;
         rid_ = 0;
@@ -239,10 +329,56 @@ private:
             env.app().overlay().relay(uint256{0}, m, toSkip);
             BEAST_EXPECT(
                 PeerTest::sendTx_ == expectRelay &&
-                PeerTest::queueTx_ == expectQueue);
+                PeerTest::queueTx_ == expectQueue &&
+                PeerTest::batchTx_ == expectBatch);
         }
     }
 
+    void
+    testBatchReceived()
+    {
+        using namespace std::chrono_literals;
+
+        testcase("batch received");
+        jtx::Env env(*this);
+        env.app().config().TX_REDUCE_RELAY_ENABLE = true;
+        PeerTest::init();
+        lid_ = 0;
+        rid_ = 0;
+        std::vector<std::shared_ptr<PeerTxQueueTest>> peers;
+        std::uint16_t nDisabled = 0;
+        addPeer(env, peers, nDisabled);
+        auto& peer = *peers.front();
+
+        auto const jtx = env.jt(noop(env.master));
+        if (!BEAST_EXPECT(jtx.stx))
+            return;
+        auto const txID = jtx.stx->getTransactionID();
+
+        // The server has the transaction, and queued it to announce to the
+        // peer, along with one the peer doesn't send
+        uint256 const other{1};
+        peer.addTxQueue(txID);
+        peer.addTxQueue(other);
+        HashRouterFlags flags;
+        env.app().getHashRouter().shouldProcess(
+            txID, peer.id() + 1, flags, 10s);
+
+        // The peer relays the transaction in a batch
+        auto batch = std::make_shared<protocol::TMTransactions>();
+        auto& m = *batch->add_transactions();
+        Serializer s;
+        jtx.stx->add(s);
+        m.set_rawtransaction(s.data(), s.size());
+        m.set_deferred(false);
+        m.set_status(protocol::TransactionStatus::tsNEW);
+        peer.onMessage(batch);
+
+        // So only the other transaction is announced back
+        peer.sendTxQueue();
+        BEAST_EXPECT(peer.waitAnnounced() == std::set<uint256>{other});
+    }
+
     void
     run() override
     {
@@ -281,6 +417,34 @@ private:
         // towards relayed (20-14=6)
         skip = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13};
         testRelay("disabled & skip, no relay", true, 20, 2, 10, 25, 0, 6, skip);
+        // batch for the peers relayed to (30), queue the rest (30)
+        testRelay(
+            "batch",
+            true,
+            60,
+            0,
+            20,
+            25,
+            0,
+            30,
+            {},
+            std::chrono::milliseconds{5},
+            30);
+        // relay to the disabled peers at once (10), batch for the enabled
+        // peers relayed to (30), queue the rest (30)
+        testRelay(
+            "batch & disabled",
+            true,
+            70,
+            10,
+            20,
+            25,
+            10,
+            30,
+            {},
+            std::chrono::milliseconds{5},
+            30);
+        testBatchReceived();
     }
 };
 
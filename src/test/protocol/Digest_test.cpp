@@ -0,0 +1,86 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+#include <xrpl/basics/Blob.h>
+#include <xrpl/basics/random.h>
+#include <xrpl/beast/unit_test.h>
+#include <xrpl/beast/utility/rngfill.h>
+#include <xrpl/protocol/digest.h>
+
+#include <vector>
+
+namespace ripple {
+
+class Digest_test : public beast::unit_test::suite
+{
+    // Checks sha512HalfBatch against sha512Half for messages of the given
+    // sizes
+    void
+    check(std::vector<std::size_t> const& sizes)
+    {
+        std::vector<Blob> data;
+        std::vector<Slice> messages;
+        for (auto const size : sizes)
+        {
+            auto& blob = data.emplace_back(size);
+            beast::rngfill(blob.data(), blob.size(), default_prng());
+        }
+        for (auto const& blob : data)
+            messages.emplace_back(blob.data(), blob.size());
+
+        std::vector<uint256> digests(messages.size());
+        sha512HalfBatch(messages, digests);
+
+        bool same = true;
+        for (std::size_t i = 0; i < messages.size(); ++i)
+            same = same && digests[i] == sha512Half(messages[i]);
+        BEAST_EXPECT(same);
+    }
+
+public:
+    void
+    testBatch()
+    {
+        testcase("batch");
+
+        // No messages, and fewer messages than a batch hashes at once
+        for (std::size_t count = 0; count <= 17; ++count)
+            check(std::vector<std::size_t>(count, 516));
+
+        // The sizes around which padding takes another block
+        check({0, 1, 111, 112, 127, 128, 239, 240, 255, 256});
+
+        // Messages of very different sizes in one batch
+        check({5000, 3, 516, 516, 70, 2000, 516, 12, 129});
+
+        std::vector<std::size_t> sizes;
+        for (int i = 0; i < 100; ++i)
+            sizes.push_back(rand_int<std::size_t>(0, 1000));
+        check(sizes);
+    }
+
+    void
+    run() override
+    {
+        testBatch();
+    }
+};
+
+BEAST_DEFINE_TESTSUITE(Digest, protocol, ripple);
+
+}  // namespace ripple
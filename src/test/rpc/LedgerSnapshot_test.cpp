@@ -0,0 +1,136 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <test/jtx.h>
+#include <test/jtx/envconfig.h>
+
+#include <xrpld/app/ledger/LedgerSnapshots.h>
+
+#include <xrpl/beast/unit_test.h>
+#include <xrpl/beast/utility/temp_dir.h>
+#include <xrpl/protocol/jss.h>
+
+#include <chrono>
+#include <thread>
+
+namespace ripple {
+namespace test {
+
+class LedgerSnapshot_test : public beast::unit_test::suite
+{
+    void
+    testNotEnabled()
+    {
+        testcase("not enabled");
+
+        using namespace jtx;
+        Env env{*this};
+        env.close();
+
+        auto const result = env.rpc("json", "ledger_snapshot", "{}");
+        BEAST_EXPECT(result[jss::result][jss::error] == "notEnabled");
+    }
+
+    void
+    testSnapshot()
+    {
+        testcase("snapshot");
+
+        using namespace jtx;
+        beast::temp_dir td;
+        Env env{*this, envconfig([&](std::unique_ptr<Config> cfg) {
+                    cfg->section("ledger_snapshots").set("path", td.path());
+                    return cfg;
+                })};
+
+        Account const alice{"alice"};
+        env.fund(XRP(10'000), alice);
+        env.close();
+
+        auto const seq = env.closed()->info().seq;
+        auto const hash = env.closed()->info().hash;
+
+        // Only a validated ledger can be pinned
+        {
+            Json::Value params;
+            params[jss::ledger_index] = "current";
+            auto const result = env.rpc(
+                "json", "ledger_snapshot", to_string(params))[jss::result];
+            BEAST_EXPECT(result[jss::error] == "lgrNotValidated");
+        }
+
+        // The snapshot is written in the background, and repeating the
+        // command reports its progress
+        auto result = env.rpc("json", "ledger_snapshot", "{}")[jss::result];
+        BEAST_EXPECT(result[jss::status] == "success");
+        BEAST_EXPECT(result[jss::ledger_index] == seq);
+        BEAST_EXPECT(
+            result[jss::snapshot] == "exporting" ||
+            result[jss::snapshot] == "pinned");
+        for (int i = 0; i < 500 && result[jss::snapshot] == "exporting"; ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            result = env.rpc("json", "ledger_snapshot", "{}")[jss::result];
+        }
+        BEAST_EXPECT(result[jss::snapshot] == "pinned");
+        BEAST_EXPECT(result[jss::nodes].asUInt() > 0);
+
+        auto const ledger =
+            env.app().getLedgerSnapshots().getLedgerBySeq(seq);
+        BEAST_EXPECT(ledger && ledger->info().hash == hash);
+        BEAST_EXPECT(
+            env.app().getLedgerSnapshots().getLedgerByHash(hash) == ledger);
+        BEAST_EXPECT(!env.app().getLedgerSnapshots().getLedgerBySeq(seq + 1));
+
+        // The pinned ledger answers queries
+        Json::Value params;
+        params[jss::ledger_index] = seq;
+        params[jss::account_root] = alice.human();
+        auto const entry =
+            env.rpc("json", "ledger_entry", to_string(params))[jss::result];
+        BEAST_EXPECT(entry[jss::node][sfAccount.jsonName] == alice.human());
+        BEAST_EXPECT(entry[jss::ledger_hash] == to_string(hash));
+
+        // Snapshots in the directory are pinned again at startup
+        if (ledger)
+        {
+            LedgerSnapshots snapshots(env.app());
+            BEAST_EXPECT(!snapshots.getLedgerBySeq(seq));
+            snapshots.load();
+            auto const loaded = snapshots.getLedgerBySeq(seq);
+            BEAST_EXPECT(loaded && loaded->info().hash == hash);
+            BEAST_EXPECT(
+                loaded && loaded->stateMap().getHash() ==
+                    ledger->stateMap().getHash());
+        }
+    }
+
+public:
+    void
+    run() override
+    {
+        testNotEnabled();
+        testSnapshot();
+    }
+};
+
+BEAST_DEFINE_TESTSUITE(LedgerSnapshot, rpc, ripple);
+
+}  // namespace test
+}  // namespace ripple
@@ -0,0 +1,108 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <test/jtx.h>
+#include <test/jtx/envconfig.h>
+
+#include <xrpld/shamap/SHAMap.h>
+
+#include <xrpl/beast/unit_test.h>
+#include <xrpl/protocol/digest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <utility>
+
+namespace ripple {
+namespace test {
+
+// NOTE This is a rather naive benchmark of hashing the dirty nodes of a state
+// map, as a ledger close does, with and without [parallel_hashing]. It
+// reports the time taken to flush maps with different numbers of dirty
+// leaves, so it is most useful to compare two builds on the same machine.
+
+class SHAMapHashTiming_test : public beast::unit_test::suite
+{
+    using clock = std::chrono::steady_clock;
+
+    // Returns the root hash and the time taken to flush the map
+    std::pair<SHAMapHash, clock::duration>
+    flush(int workers, std::uint32_t leaves)
+    {
+        using namespace jtx;
+
+        Env env{*this, envconfig([workers](std::unique_ptr<Config> cfg) {
+                    cfg->FORCE_MULTI_THREAD = true;
+                    cfg->PARALLEL_HASH_WORKERS = workers;
+                    return cfg;
+                })};
+
+        SHAMap map(SHAMapType::STATE, env.app().getNodeFamily());
+        for (std::uint32_t i = 0; i < leaves; ++i)
+        {
+            auto const k = sha512Half(i);
+            map.addItem(
+                SHAMapNodeType::tnACCOUNT_STATE,
+                make_shamapitem(k, Slice{k.data(), k.size()}));
+        }
+
+        auto const start = clock::now();
+        map.flushDirty(hotACCOUNT_NODE);
+        auto const elapsed = clock::now() - start;
+
+        return {map.getHash(), elapsed};
+    }
+
+    void
+    testFlush(std::uint32_t leaves)
+    {
+        using namespace std::chrono;
+
+        testcase << leaves << " dirty leaves";
+
+        auto const workers = std::clamp(
+            static_cast<int>(std::thread::hardware_concurrency()), 1, 64);
+
+        auto const ms = [](clock::duration d) {
+            return duration_cast<duration<double, std::milli>>(d).count();
+        };
+
+        auto const [serialHash, serial] = flush(0, leaves);
+        auto const [parallelHash, parallel] = flush(workers, leaves);
+        BEAST_EXPECT(serialHash == parallelHash);
+
+        log << "serial: " << ms(serial) << " ms, " << workers
+            << " workers: " << ms(parallel) << " ms" << std::endl;
+    }
+
+public:
+    void
+    run() override
+    {
+        testFlush(1'000);
+        testFlush(10'000);
+        testFlush(100'000);
+    }
+};
+
+BEAST_DEFINE_TESTSUITE_MANUAL(SHAMapHashTiming, shamap, ripple);
+
+}  // namespace test
+}  // namespace ripple
@@ -0,0 +1,222 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <test/shamap/common.h>
+#include <test/unit_test/SuiteJournal.h>
+
+#include <xrpld/shamap/SHAMap.h>
+#include <xrpld/shamap/SHAMapSnapshotFile.h>
+#include <xrpld/shamap/SnapshotFamily.h>
+
+#include <xrpl/beast/unit_test.h>
+#include <xrpl/beast/utility/temp_dir.h>
+#include <xrpl/protocol/digest.h>
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+#include <set>
+#include <string>
+
+namespace ripple {
+namespace tests {
+
+class SHAMapSnapshotFile_test : public beast::unit_test::suite
+{
+    static void
+    add(SHAMap& map, std::uint32_t i)
+    {
+        auto const k = sha512Half(i);
+        map.addItem(
+            SHAMapNodeType::tnACCOUNT_STATE,
+            make_shamapitem(k, Slice{k.data(), k.size()}));
+    }
+
+    static std::string
+    contents(boost::filesystem::path const& path)
+    {
+        std::ifstream in(path.string(), std::ios::binary);
+        return {std::istreambuf_iterator<char>(in), {}};
+    }
+
+    void
+    testRoundTrip(beast::Journal const& journal)
+    {
+        testcase("round trip");
+
+        beast::temp_dir td;
+        auto const path = boost::filesystem::path{td.file("map.snapshot")};
+
+        TestNodeFamily f(journal);
+        SHAMap map(SHAMapType::STATE, f);
+        for (std::uint32_t i = 0; i < 1000; ++i)
+            add(map, i);
+        map.flushDirty(hotACCOUNT_NODE);
+        map.setImmutable();
+
+        // An empty map adds no nodes
+        SHAMap empty(SHAMapType::TRANSACTION, f);
+        empty.setImmutable();
+
+        std::set<SHAMapHash> hashes;
+        map.visitNodes([&](SHAMapTreeNode& node) {
+            hashes.insert(node.getHash());
+            return true;
+        });
+
+        std::string const userData = "ledger header";
+        BEAST_EXPECT(
+            SHAMapSnapshotFile::write(
+                path, makeSlice(userData), {&map, &empty}) == hashes.size());
+        BEAST_EXPECT(!boost::filesystem::exists(path.string() + ".tmp"));
+
+        // An index sorted in many runs is merged into the same file, and a
+        // node in more than one map is still only indexed once
+        {
+            auto const runs = boost::filesystem::path{td.file("runs.snapshot")};
+            BEAST_EXPECT(
+                SHAMapSnapshotFile::write(
+                    runs, makeSlice(userData), {&map, &empty}, 64) ==
+                hashes.size());
+            BEAST_EXPECT(
+                !boost::filesystem::exists(runs.string() + ".index.tmp"));
+            BEAST_EXPECT(contents(runs) == contents(path));
+
+            BEAST_EXPECT(
+                SHAMapSnapshotFile::write(runs, {}, {&map, &map}, 64) ==
+                hashes.size());
+            BEAST_EXPECT(SHAMapSnapshotFile(runs).size() == hashes.size());
+        }
+
+        auto const file = std::make_shared<SHAMapSnapshotFile>(path);
+        BEAST_EXPECT(file->size() == hashes.size());
+        BEAST_EXPECT(file->userData() == makeSlice(userData));
+        BEAST_EXPECT(!file->fetch(sha512Half(std::uint32_t{0})));
+        for (auto const& hash : hashes)
+        {
+            auto const data = file->fetch(hash.as_uint256());
+            BEAST_EXPECT(data && sha512Half(*data) == hash.as_uint256());
+        }
+
+        // A map read from the file has the same items, and never touches the
+        // database of the family it was written from
+        SnapshotFamily sf(file, journal);
+        SHAMap copy(SHAMapType::STATE, map.getHash().as_uint256(), sf);
+        BEAST_EXPECT(copy.fetchRoot(map.getHash(), nullptr));
+        copy.setImmutable();
+        BEAST_EXPECT(copy.getHash() == map.getHash());
+
+        std::size_t items = 0;
+        for (auto const& item : copy)
+        {
+            BEAST_EXPECT(map.hasItem(item.key()));
+            ++items;
+        }
+        BEAST_EXPECT(items == 1000);
+
+        std::set<SHAMapHash> visited;
+        copy.visitNodesBatched([&](SHAMapTreeNode& node) {
+            visited.insert(node.getHash());
+            return true;
+        });
+        BEAST_EXPECT(visited == hashes);
+
+        std::vector<SHAMapMissingNode> missing;
+        copy.walkMap(missing, 32);
+        BEAST_EXPECT(missing.empty());
+    }
+
+    void
+    testMalformed(beast::Journal const& journal)
+    {
+        testcase("malformed");
+
+        beast::temp_dir td;
+        auto const path = boost::filesystem::path{td.file("map.snapshot")};
+
+        auto const fails = [&]() {
+            try
+            {
+                SHAMapSnapshotFile file(path);
+            }
+            catch (std::runtime_error const&)
+            {
+                return true;
+            }
+            return false;
+        };
+
+        // Missing
+        BEAST_EXPECT(fails());
+
+        // Not a snapshot
+        {
+            std::ofstream out(path.string(), std::ios::binary);
+            out << std::string(1000, 'x');
+        }
+        BEAST_EXPECT(fails());
+
+        // Truncated
+        TestNodeFamily f(journal);
+        SHAMap map(SHAMapType::STATE, f);
+        for (std::uint32_t i = 0; i < 100; ++i)
+            add(map, i);
+        map.flushDirty(hotACCOUNT_NODE);
+        SHAMapSnapshotFile::write(path, {}, {&map});
+        BEAST_EXPECT(!fails());
+        boost::filesystem::resize_file(
+            path, boost::filesystem::file_size(path) - 1);
+        BEAST_EXPECT(fails());
+
+        // A damaged node reads as missing
+        SHAMapSnapshotFile::write(path, {}, {&map});
+        {
+            std::fstream io(
+                path.string(), std::ios::in | std::ios::out | std::ios::binary);
+            // The first node follows the 48 byte header
+            io.seekg(48 + 8);
+            auto const c = static_cast<char>(io.get() ^ 1);
+            io.seekp(48 + 8);
+            io.put(c);
+        }
+        SHAMapSnapshotFile file(path);
+        std::size_t found = 0;
+        map.visitNodes([&](SHAMapTreeNode& node) {
+            if (file.fetch(node.getHash().as_uint256()))
+                ++found;
+            return true;
+        });
+        BEAST_EXPECT(found + 1 == file.size());
+    }
+
+public:
+    void
+    run() override
+    {
+        test::SuiteJournal journal("SHAMapSnapshotFile_test", *this);
+
+        testRoundTrip(journal);
+        testMalformed(journal);
+    }
+};
+
+BEAST_DEFINE_TESTSUITE(SHAMapSnapshotFile, shamap, ripple);
+
+}  // namespace tests
+}  // namespace ripple
@@ -26,6 +26,12 @@
 #include <xrpl/basics/Buffer.h>
 #include <xrpl/beast/unit_test.h>
 #include <xrpl/beast/utility/Journal.h>
+#include <xrpl/protocol/digest.h>
+
+#include <algorithm>
+#include <set>
+#include <thread>
+#include <vector>
 
 namespace ripple {
 namespace tests {
@@ -116,6 +122,221 @@ public:
         return vuc;
     }
 
+    // Flushes the subtrees of a map on separate threads, starting with the
+    // last one
+    class ThreadedNodeFamily : public TestNodeFamily
+    {
+    public:
+        using TestNodeFamily::TestNodeFamily;
+
+        int calls = 0;
+
+        void
+        runParallel(std::size_t count, std::function<void(std::size_t)> f)
+            override
+        {
+            ++calls;
+            std::vector<std::thread> threads;
+            for (std::size_t i = count; i-- > 0;)
+                threads.emplace_back(f, i);
+            for (auto& thread : threads)
+                thread.join();
+        }
+    };
+
+    void
+    testParallelFlush(beast::Journal const& journal)
+    {
+        testcase("parallel flush");
+
+        TestNodeFamily f(journal);
+        ThreadedNodeFamily tf(journal);
+        SHAMap map(SHAMapType::STATE, f);
+        SHAMap threadedMap(SHAMapType::STATE, tf);
+
+        auto const add = [](SHAMap& m, std::uint32_t i) {
+            auto const k = sha512Half(i);
+            m.addItem(
+                SHAMapNodeType::tnACCOUNT_STATE,
+                make_shamapitem(k, Slice{k.data(), k.size()}));
+        };
+
+        for (std::uint32_t i = 0; i < 2000; ++i)
+        {
+            add(map, i);
+            add(threadedMap, i);
+        }
+        BEAST_EXPECT(
+            map.flushDirty(hotACCOUNT_NODE) ==
+            threadedMap.flushDirty(hotACCOUNT_NODE));
+        BEAST_EXPECT(map.getHash() == threadedMap.getHash());
+        BEAST_EXPECT(tf.calls == 1);
+        map.invariants();
+        threadedMap.invariants();
+
+        // Change a mutable snapshot of each map
+        auto const snap = map.snapShot(true);
+        auto const threadedSnap = threadedMap.snapShot(true);
+        for (std::uint32_t i = 2000; i < 2100; ++i)
+        {
+            add(*snap, i);
+            add(*threadedSnap, i);
+        }
+        BEAST_EXPECT(
+            snap->flushDirty(hotACCOUNT_NODE) ==
+            threadedSnap->flushDirty(hotACCOUNT_NODE));
+        BEAST_EXPECT(snap->getHash() == threadedSnap->getHash());
+        BEAST_EXPECT(snap->getHash() != map.getHash());
+        BEAST_EXPECT(tf.calls == 2);
+        threadedSnap->invariants();
+    }
+
+    // Reads nodes in small batches, and counts them
+    class BatchingNodeFamily : public TestNodeFamily
+    {
+    public:
+        using TestNodeFamily::TestNodeFamily;
+
+        int batches = 0;
+        std::size_t largest = 0;
+
+        std::size_t
+        fetchBatchSize() const override
+        {
+            return 64;
+        }
+
+        std::vector<std::shared_ptr<NodeObject>>
+        fetchBatch(std::vector<uint256> const& hashes) override
+        {
+            ++batches;
+            largest = std::max(largest, hashes.size());
+            return TestNodeFamily::fetchBatch(hashes);
+        }
+    };
+
+    void
+    testBatchedWalk(beast::Journal const& journal)
+    {
+        testcase("batched walk");
+
+        BatchingNodeFamily f(journal);
+        SHAMap map(SHAMapType::STATE, f);
+        for (std::uint32_t i = 0; i < 2000; ++i)
+        {
+            auto const k = sha512Half(i);
+            map.addItem(
+                SHAMapNodeType::tnACCOUNT_STATE,
+                make_shamapitem(k, Slice{k.data(), k.size()}));
+        }
+        map.flushDirty(hotACCOUNT_NODE);
+        map.setImmutable();
+
+        std::set<SHAMapHash> expected;
+        map.visitNodes([&](SHAMapTreeNode& node) {
+            expected.insert(node.getHash());
+            return true;
+        });
+
+        // Returns a copy of the map with only its root in memory
+        auto const load = [&]() {
+            f.reset();
+            auto copy = std::make_shared<SHAMap>(
+                SHAMapType::STATE, map.getHash().as_uint256(), f);
+            BEAST_EXPECT(copy->fetchRoot(map.getHash(), nullptr));
+            copy->setImmutable();
+            return copy;
+        };
+
+        {
+            std::set<SHAMapHash> visited;
+            load()->visitNodesBatched([&](SHAMapTreeNode& node) {
+                visited.insert(node.getHash());
+                return true;
+            });
+            BEAST_EXPECT(visited == expected);
+            BEAST_EXPECT(f.batches > 0);
+            BEAST_EXPECT(f.largest > 1 && f.largest <= 64);
+        }
+
+        {
+            f.batches = 0;
+            std::set<SHAMapHash> visited;
+            load()->visitDifferences(nullptr, [&](SHAMapTreeNode const& node) {
+                visited.insert(node.getHash());
+                return true;
+            });
+            BEAST_EXPECT(visited == expected);
+            BEAST_EXPECT(f.batches > 0);
+        }
+
+        {
+            std::vector<SHAMapMissingNode> missing;
+            load()->walkMap(missing, 32);
+            BEAST_EXPECT(missing.empty());
+        }
+
+        {
+            // Stops when asked to
+            int count = 0;
+            load()->visitNodesBatched(
+                [&](SHAMapTreeNode&) { return ++count < 100; });
+            BEAST_EXPECT(count == 100);
+        }
+    }
+
+    void
+    testInnerNodeArena(beast::Journal const& journal)
+    {
+        testcase("inner node arena");
+
+        auto const before = SHAMapInnerNode::getArenaCounts();
+        std::size_t inners = 0;
+        {
+            TestNodeFamily f(journal);
+            SHAMap map(SHAMapType::STATE, f);
+            for (std::uint32_t i = 0; i < 2000; ++i)
+            {
+                auto const k = sha512Half(i);
+                map.addItem(
+                    SHAMapNodeType::tnACCOUNT_STATE,
+                    make_shamapitem(k, Slice{k.data(), k.size()}));
+            }
+            map.flushDirty(hotACCOUNT_NODE);
+
+            // Every hash lies within one cache line, and the hashes of a
+            // dense node start on a cache line.
+            map.visitNodes([&](SHAMapTreeNode& node) {
+                if (!node.isInner())
+                    return true;
+                ++inners;
+                auto& inner = static_cast<SHAMapInnerNode&>(node);
+                for (int b = 0; b < SHAMapInnerNode::branchFactor; ++b)
+                {
+                    if (inner.isEmptyBranch(b))
+                        continue;
+                    auto const p = reinterpret_cast<std::uintptr_t>(
+                        &inner.getChildHash(b));
+                    BEAST_EXPECT(p % 32 == 0);
+                }
+                if (inner.getBranchCount() > 6)
+                {
+                    auto const p = reinterpret_cast<std::uintptr_t>(
+                        &inner.getChildHash(0));
+                    BEAST_EXPECT(p % 64 == 0);
+                }
+                return true;
+            });
+
+            auto const counts = SHAMapInnerNode::getArenaCounts();
+            BEAST_EXPECT(counts.allocations >= before.allocations + inners);
+            BEAST_EXPECT(counts.used > 0);
+            BEAST_EXPECT(counts.reserved >= counts.used);
+        }
+        auto const after = SHAMapInnerNode::getArenaCounts();
+        BEAST_EXPECT(after.deallocations >= before.deallocations + inners);
+    }
+
     void
     run() override
     {
@@ -124,6 +345,9 @@ public:
 
         run(true, journal);
         run(false, journal);
+        testParallelFlush(journal);
+        testBatchedWalk(journal);
+        testInnerNodeArena(journal);
     }
 
     void
@@ -0,0 +1,222 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <xrpld/app/ledger/LedgerSnapshots.h>
+#include <xrpld/app/main/Application.h>
+#include <xrpld/core/Config.h>
+#include <xrpld/core/ConfigSections.h>
+#include <xrpld/core/JobQueue.h>
+
+#include <xrpl/basics/Log.h>
+#include <xrpl/basics/contract.h>
+#include <xrpl/protocol/LedgerHeader.h>
+#include <xrpl/protocol/Serializer.h>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <string>
+
+namespace ripple {
+
+static char const* const snapshotExtension = ".snapshot";
+
+LedgerSnapshots::LedgerSnapshots(Application& app)
+    : app_(app), j_(app.journal("LedgerSnapshots"))
+{
+    std::string dir;
+    if (get_if_exists(
+            app.config().section(SECTION_LEDGER_SNAPSHOTS), "path", dir))
+        dir_ = dir;
+}
+
+void
+LedgerSnapshots::load()
+{
+    if (!enabled())
+        return;
+
+    boost::system::error_code ec;
+    boost::filesystem::directory_iterator it(dir_, ec);
+    if (ec)
+    {
+        // Nothing has been exported yet
+        JLOG(j_.debug()) << "Can't read " << dir_.string() << ": "
+                         << ec.message();
+        return;
+    }
+
+    for (; !ec && it != boost::filesystem::directory_iterator();
+         it.increment(ec))
+    {
+        auto const& path = it->path();
+        if (path.extension() != snapshotExtension)
+            continue;
+
+        try
+        {
+            auto const snapshot = open(path);
+            auto const seq = snapshot->ledger->info().seq;
+            JLOG(j_.info()) << "Pinned ledger " << seq << " from "
+                            << path.string();
+            std::lock_guard lock(mutex_);
+            snapshots_[seq] = snapshot;
+        }
+        catch (std::exception const& e)
+        {
+            JLOG(j_.warn()) << "Skipping snapshot " << path.string() << ": "
+                            << e.what();
+        }
+    }
+}
+
+LedgerSnapshots::ExportStatus
+LedgerSnapshots::exportLedger(std::shared_ptr<Ledger const> const& ledger)
+{
+    if (!enabled())
+        Throw<std::runtime_error>("No directory for ledger snapshots");
+
+    auto const seq = ledger->info().seq;
+    {
+        std::lock_guard lock(mutex_);
+        if (auto const it = snapshots_.find(seq); it != snapshots_.end())
+            return {ExportState::pinned, it->second->file->size(), {}};
+
+        if (auto const it = exports_.find(seq); it != exports_.end())
+        {
+            auto const status = it->second;
+            if (status.state == ExportState::failed)
+                exports_.erase(it);
+            return status;
+        }
+
+        exports_[seq] = {};
+    }
+
+    if (!app_.getJobQueue().addJob(
+            jtADMIN, "LedgerSnapshots::export", [this, ledger]() {
+                write(*ledger);
+            }))
+    {
+        std::lock_guard lock(mutex_);
+        exports_.erase(seq);
+        return {ExportState::failed, 0, "The server is shutting down"};
+    }
+
+    return {};
+}
+
+void
+LedgerSnapshots::write(Ledger const& ledger)
+{
+    auto const seq = ledger.info().seq;
+    try
+    {
+        boost::filesystem::create_directories(dir_);
+        auto const path =
+            dir_ / ("ledger_" + std::to_string(seq) + snapshotExtension);
+
+        // The header of the ledger is kept with its nodes, so the ledger can
+        // be rebuilt from the file alone
+        Serializer header;
+        addRaw(ledger.info(), header, true);
+
+        auto const nodes = SHAMapSnapshotFile::write(
+            path, header.slice(), {&ledger.stateMap(), &ledger.txMap()});
+        auto const snapshot = open(path);
+
+        JLOG(j_.info()) << "Pinned ledger " << seq << " with " << nodes
+                        << " nodes in " << path.string();
+        std::lock_guard lock(mutex_);
+        snapshots_[seq] = snapshot;
+        exports_.erase(seq);
+    }
+    catch (std::exception const& e)
+    {
+        JLOG(j_.warn()) << "Snapshot of ledger " << seq
+                        << " failed: " << e.what();
+        std::lock_guard lock(mutex_);
+        exports_[seq] = {ExportState::failed, 0, e.what()};
+    }
+}
+
+std::shared_ptr<Ledger const>
+LedgerSnapshots::getLedgerBySeq(LedgerIndex seq) const
+{
+    std::lock_guard lock(mutex_);
+    auto const it = snapshots_.find(seq);
+    if (it == snapshots_.end())
+        return nullptr;
+    return ledgerOf(it->second);
+}
+
+std::shared_ptr<Ledger const>
+LedgerSnapshots::getLedgerByHash(uint256 const& hash) const
+{
+    std::lock_guard lock(mutex_);
+    for (auto const& [seq, snapshot] : snapshots_)
+    {
+        if (snapshot->ledger->info().hash == hash)
+            return ledgerOf(snapshot);
+    }
+    return nullptr;
+}
+
+void
+LedgerSnapshots::sweep()
+{
+    std::lock_guard lock(mutex_);
+    for (auto const& [seq, snapshot] : snapshots_)
+        snapshot->family->sweep();
+}
+
+std::shared_ptr<LedgerSnapshots::Snapshot>
+LedgerSnapshots::open(boost::filesystem::path const& path) const
+{
+    auto snapshot = std::make_shared<Snapshot>();
+    snapshot->file = std::make_shared<SHAMapSnapshotFile>(path);
+
+    auto const info = deserializeHeader(snapshot->file->userData(), true);
+    if (calculateLedgerHash(info) != info.hash)
+        Throw<std::runtime_error>("Ledger header doesn't match its hash");
+
+    snapshot->family = std::make_unique<SnapshotFamily>(
+        snapshot->file, app_.journal("SnapshotFamily"));
+
+    bool loaded;
+    snapshot->ledger = std::make_shared<Ledger>(
+        info,
+        loaded,
+        false,
+        app_.config(),
+        *snapshot->family,
+        app_.journal("Ledger"));
+    if (!loaded)
+        Throw<std::runtime_error>("Ledger is incomplete");
+    snapshot->ledger->setFull();
+
+    return snapshot;
+}
+
+std::shared_ptr<Ledger const>
+LedgerSnapshots::ledgerOf(std::shared_ptr<Snapshot> const& snapshot)
+{
+    return {snapshot, snapshot->ledger.get()};
+}
+
+}  // namespace ripple
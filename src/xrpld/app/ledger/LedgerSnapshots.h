@@ -0,0 +1,147 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#ifndef RIPPLE_APP_LEDGER_LEDGERSNAPSHOTS_H_INCLUDED
+#define RIPPLE_APP_LEDGER_LEDGERSNAPSHOTS_H_INCLUDED
+
+#include <xrpld/app/ledger/Ledger.h>
+#include <xrpld/shamap/SHAMapSnapshotFile.h>
+#include <xrpld/shamap/SnapshotFamily.h>
+
+#include <xrpl/basics/base_uint.h>
+#include <xrpl/beast/utility/Journal.h>
+#include <xrpl/protocol/Protocol.h>
+
+#include <boost/filesystem/path.hpp>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace ripple {
+
+class Application;
+
+/** Validated ledgers read from memory-mapped snapshot files.
+
+    Serving queries against an old ledger normally reads its nodes through
+    the node family, which fills the caches the open ledger relies on with
+    nodes nobody else needs. A snapshot file holds every node of a ledger
+    instead, so a pinned ledger is served from the file alone, without the
+    node store and without touching the caches of the node family.
+
+    Snapshots are written in the background by the ledger_snapshot command
+    to the directory given by the path in the [ledger_snapshots] section.
+    Every snapshot in the directory is opened at startup and stays pinned
+    until shutdown.
+*/
+class LedgerSnapshots
+{
+public:
+    explicit LedgerSnapshots(Application& app);
+
+    /** Whether there is a directory to keep snapshots in. */
+    bool
+    enabled() const
+    {
+        return !dir_.empty();
+    }
+
+    /** Open and pin the snapshots in the directory. A snapshot that can't be
+        opened is skipped.
+    */
+    void
+    load();
+
+    /** How far the export of a ledger has got. */
+    enum class ExportState { running, pinned, failed };
+
+    struct ExportStatus
+    {
+        ExportState state = ExportState::running;
+
+        // The number of nodes in the snapshot, once it is pinned
+        std::size_t nodes = 0;
+
+        // Why the export failed, if it did
+        std::string error;
+    };
+
+    /** Start writing a snapshot of a validated ledger, and pin it once it
+        is written.
+
+        The snapshot is written on a job, since reading a whole ledger can
+        take a while. Nothing is started if the ledger is pinned already or
+        is being written, so calling this again reports the progress of the
+        export. A failure is reported once, and the export is started again
+        on the next call.
+
+        @return The status of the export of the ledger.
+    */
+    ExportStatus
+    exportLedger(std::shared_ptr<Ledger const> const& ledger);
+
+    /** Return a pinned ledger, or nullptr if there's no snapshot of it. */
+    std::shared_ptr<Ledger const>
+    getLedgerBySeq(LedgerIndex seq) const;
+
+    std::shared_ptr<Ledger const>
+    getLedgerByHash(uint256 const& hash) const;
+
+    /** Sweep the caches of the snapshots. */
+    void
+    sweep();
+
+private:
+    // A pinned ledger, with the file and family it is read through. The
+    // ledger is declared last, so it is destroyed before its family.
+    struct Snapshot
+    {
+        std::shared_ptr<SHAMapSnapshotFile const> file;
+        std::unique_ptr<SnapshotFamily> family;
+        std::shared_ptr<Ledger> ledger;
+    };
+
+    std::shared_ptr<Snapshot>
+    open(boost::filesystem::path const& path) const;
+
+    // Write and pin a snapshot, recording the outcome in exports_
+    void
+    write(Ledger const& ledger);
+
+    // Returns the ledger of the snapshot, which keeps the snapshot alive
+    static std::shared_ptr<Ledger const>
+    ledgerOf(std::shared_ptr<Snapshot> const& snapshot);
+
+    Application& app_;
+    beast::Journal const j_;
+    boost::filesystem::path dir_;
+
+    mutable std::mutex mutex_;
+    std::map<LedgerIndex, std::shared_ptr<Snapshot>> snapshots_;
+
+    // The exports which are running or have failed. A ledger is only
+    // written by one job at a time, since a second request finds it here.
+    std::map<LedgerIndex, ExportStatus> exports_;
+};
+
+}  // namespace ripple
+
+#endif
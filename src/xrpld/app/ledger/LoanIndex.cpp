@@ -0,0 +1,264 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <xrpld/app/ledger/LedgerMaster.h>
+#include <xrpld/app/ledger/LoanIndex.h>
+#include <xrpld/app/main/Application.h>
+#include <xrpld/core/JobQueue.h>
+#include <xrpld/shamap/SHAMapMissingNode.h>
+
+#include <xrpl/basics/Log.h>
+#include <xrpl/ledger/View.h>
+#include <xrpl/protocol/Indexes.h>
+
+#include <algorithm>
+
+namespace ripple {
+
+LoanIndex::LoanIndex(Application& app)
+    : app_(app), j_(app.journal("LoanIndex"))
+{
+}
+
+void
+LoanIndex::Loans::insert(SLE const& sle)
+{
+    auto const& key = sle.key();
+    erase(key);
+
+    // Loans that are paid off are never due again
+    auto const dueDate = sle[~sfNextPaymentDueDate];
+    if (!dueDate || sle[sfPaymentRemaining] == 0)
+        return;
+
+    Loan const loan{sle[sfLoanBrokerID], *dueDate};
+    brokers[loan.brokerID].emplace(loan.dueDate, key);
+    loans.emplace(key, loan);
+}
+
+void
+LoanIndex::Loans::erase(uint256 const& key)
+{
+    auto const it = loans.find(key);
+    if (it == loans.end())
+        return;
+
+    auto const broker = brokers.find(it->second.brokerID);
+    if (broker != brokers.end())
+    {
+        broker->second.erase({it->second.dueDate, key});
+        if (broker->second.empty())
+            brokers.erase(broker);
+    }
+    loans.erase(it);
+}
+
+void
+LoanIndex::update(std::shared_ptr<AcceptedLedger> const& accepted)
+{
+    std::lock_guard lock(mutex_);
+
+    // Applied once the index is built
+    if (building_)
+    {
+        pending_.push_back(accepted);
+        return;
+    }
+
+    apply(*accepted);
+}
+
+void
+LoanIndex::apply(AcceptedLedger const& accepted)
+{
+    auto const& ledger = accepted.getLedger();
+
+    // Nobody has needed the index yet, or it is waiting to be rebuilt
+    if (!ledger_)
+        return;
+
+    // Already reflected in the index
+    if (ledger->seq() <= ledger_->seq())
+        return;
+
+    if (ledger->seq() != ledger_->seq() + 1 ||
+        ledger->info().parentHash != ledger_->info().hash)
+    {
+        JLOG(j_.debug()) << "Discarding index at " << ledger_->seq()
+                         << ": ledger " << ledger->seq() << " is not next";
+        ledger_.reset();
+        loans_ = {};
+        return;
+    }
+
+    for (auto const& alTx : accepted)
+    {
+        for (auto const& node : alTx->getMeta().getNodes())
+        {
+            if (node.getFieldU16(sfLedgerEntryType) != ltLOAN)
+                continue;
+
+            auto const key = node.getFieldH256(sfLedgerIndex);
+            // Read the final state from the ledger, since a loan may be
+            // changed by more than one transaction in the ledger.
+            if (auto const sle = node.getFName() != sfDeletedNode
+                    ? ledger->read(keylet::loan(key))
+                    : nullptr)
+                loans_.insert(*sle);
+            else
+                loans_.erase(key);
+        }
+    }
+
+    ledger_ = ledger;
+}
+
+void
+LoanIndex::rebuild()
+{
+    auto const ledger = app_.getLedgerMaster().getPublishedLedger();
+
+    Loans loans;
+    bool built = false;
+    if (ledger)
+    {
+        JLOG(j_.debug()) << "Building index from ledger " << ledger->seq();
+        try
+        {
+            built = true;
+            for (auto const& sle : ledger->sles)
+            {
+                if (app_.isStopping())
+                {
+                    built = false;
+                    break;
+                }
+
+                if (sle->getType() == ltLOAN)
+                    loans.insert(*sle);
+            }
+        }
+        catch (SHAMapMissingNode const& mn)
+        {
+            JLOG(j_.info()) << "Missing node in " << ledger->seq()
+                            << " during build: " << mn.what();
+            built = false;
+        }
+    }
+
+    std::lock_guard lock(mutex_);
+    building_ = false;
+    auto const pending = std::move(pending_);
+    pending_.clear();
+
+    if (!built)
+        return;
+
+    JLOG(j_.debug()) << "Index built from ledger " << ledger->seq() << ": "
+                     << loans.loans.size() << " loans, " << pending.size()
+                     << " ledgers to apply";
+    ledger_ = ledger;
+    loans_ = std::move(loans);
+
+    for (auto const& accepted : pending)
+        apply(*accepted);
+}
+
+LoanIndex::Loans
+LoanIndex::readLoans(ReadView const& ledger, uint256 const& brokerID) const
+{
+    Loans loans;
+
+    auto const broker = ledger.read(keylet::loanbroker(brokerID));
+    if (!broker)
+        return loans;
+
+    forEachItem(
+        ledger,
+        keylet::ownerDir(broker->at(sfAccount)),
+        [&](std::shared_ptr<SLE const> const& sle) {
+            if (sle && sle->getType() == ltLOAN &&
+                sle->at(sfLoanBrokerID) == brokerID)
+                loans.insert(*sle);
+        });
+
+    return loans;
+}
+
+std::optional<LoanIndex::LoansDue>
+LoanIndex::getLoansDue(
+    uint256 const& brokerID,
+    std::uint32_t dueBefore,
+    std::optional<Entry> const& after,
+    std::size_t limit)
+{
+    std::unique_lock lock(mutex_);
+
+    bool const indexed = ledger_ != nullptr;
+    std::shared_ptr<ReadView const> ledger = ledger_;
+    Loans unindexed;
+    if (!indexed)
+    {
+        ledger = app_.getLedgerMaster().getPublishedLedger();
+        if (!ledger)
+            return std::nullopt;
+
+        if (!building_)
+        {
+            building_ = true;
+            if (!app_.getJobQueue().addJob(
+                    jtUPDATE_PF, "LoanIndex::rebuild", [this]() { rebuild(); }))
+                building_ = false;
+        }
+
+        // Don't hold up the publishing of ledgers while the ledger is read
+        lock.unlock();
+        unindexed = readLoans(*ledger, brokerID);
+    }
+    Loans const& loans = indexed ? loans_ : unindexed;
+
+    LoansDue result;
+    result.ledgerSeq = ledger->seq();
+    result.ledgerHash = ledger->info().hash;
+    result.closeTime = ledger->info().closeTime.time_since_epoch().count();
+    result.indexed = indexed;
+
+    auto const broker = loans.brokers.find(brokerID);
+    if (broker == loans.brokers.end())
+        return result;
+
+    // Always make progress, even if asked for no loans
+    limit = std::max<std::size_t>(limit, 1);
+
+    auto const& entries = broker->second;
+    auto it = after ? entries.upper_bound(*after) : entries.begin();
+    for (; it != entries.end() && it->first < dueBefore; ++it)
+    {
+        if (result.loans.size() >= limit)
+        {
+            result.marker = result.loans.back();
+            break;
+        }
+        result.loans.push_back(*it);
+    }
+
+    return result;
+}
+
+}  // namespace ripple
@@ -0,0 +1,156 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#ifndef RIPPLE_APP_LEDGER_LOANINDEX_H_INCLUDED
+#define RIPPLE_APP_LEDGER_LOANINDEX_H_INCLUDED
+
+#include <xrpld/app/ledger/AcceptedLedger.h>
+
+#include <xrpl/basics/UnorderedContainers.h>
+#include <xrpl/basics/base_uint.h>
+#include <xrpl/beast/utility/Journal.h>
+#include <xrpl/protocol/Protocol.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace ripple {
+
+class Application;
+
+/** An in-memory index of the active loans of every LoanBroker.
+
+    Finding the loans of a broker in the ledger means walking the owner
+    directory of the broker's pseudo-account and reading every Loan object.
+    This index instead keeps the loans of each broker ordered by their next
+    payment due date, so servicers can find the loans due before a given time
+    directly.
+
+    The index follows the published ledgers. The first query starts a
+    background job which builds it from a full scan of the last published
+    ledger, and it is then updated from the metadata of each published
+    ledger. Ledgers published during the scan are held and applied once the
+    scan is done. If a published ledger is skipped, the index is discarded
+    and rebuilt after the next query. Until the index is built, queries are
+    answered from the broker's directory in the last published ledger.
+*/
+class LoanIndex
+{
+public:
+    /** A loan, ordered by its next payment due date. */
+    using Entry = std::pair<std::uint32_t, uint256>;
+
+    struct LoansDue
+    {
+        // The ledger the index reflects
+        LedgerIndex ledgerSeq = 0;
+        uint256 ledgerHash;
+        // The close time of that ledger, for deciding which loans are late
+        std::uint32_t closeTime = 0;
+        std::vector<Entry> loans;
+        // Set if there are more loans to return
+        std::optional<Entry> marker;
+        // False if the loans were read from the ledger instead of the index
+        bool indexed = true;
+    };
+
+    explicit LoanIndex(Application& app);
+
+    /** Applies the loan changes of a newly published ledger. */
+    void
+    update(std::shared_ptr<AcceptedLedger> const& accepted);
+
+    /** Returns the active loans of a broker with a next payment due before
+        the given time, in due date order.
+
+        @param brokerID The LoanBroker to return the loans of.
+        @param dueBefore Only return loans due strictly before this time.
+        @param after If set, only return loans ordered after this entry.
+        @param limit The maximum number of loans to return.
+
+        @return The loans, or nothing if there is no published ledger.
+    */
+    std::optional<LoansDue>
+    getLoansDue(
+        uint256 const& brokerID,
+        std::uint32_t dueBefore,
+        std::optional<Entry> const& after,
+        std::size_t limit);
+
+private:
+    // The loans of every broker, indexed both ways
+    struct Loans
+    {
+        struct Loan
+        {
+            uint256 brokerID;
+            std::uint32_t dueDate;
+        };
+
+        hash_map<uint256, std::set<Entry>> brokers;
+        hash_map<uint256, Loan> loans;
+
+        // Adds or updates the loan in the SLE, or removes it if it no longer
+        // has payments due.
+        void
+        insert(SLE const& sle);
+
+        void
+        erase(uint256 const& key);
+    };
+
+    // Applies the loan changes of a ledger to the index. The mutex must be
+    // held.
+    void
+    apply(AcceptedLedger const& accepted);
+
+    // Builds the index from the last published ledger, then applies the
+    // ledgers published in the meantime. Runs on a job.
+    void
+    rebuild();
+
+    // Reads the loans of a broker from the broker's directory in a ledger.
+    Loans
+    readLoans(ReadView const& ledger, uint256 const& brokerID) const;
+
+    Application& app_;
+    beast::Journal const j_;
+
+    std::mutex mutex_;
+
+    // The ledger the index reflects, or null if it needs to be rebuilt
+    std::shared_ptr<ReadView const> ledger_;
+
+    Loans loans_;
+
+    // Set while a job is building the index
+    bool building_ = false;
+
+    // The ledgers published while the index is being built
+    std::vector<std::shared_ptr<AcceptedLedger>> pending_;
+};
+
+}  // namespace ripple
+
+#endif
@@ -23,7 +23,9 @@
 #include <xrpld/app/ledger/LedgerCleaner.h>
 #include <xrpld/app/ledger/LedgerMaster.h>
 #include <xrpld/app/ledger/LedgerReplayer.h>
+#include <xrpld/app/ledger/LedgerSnapshots.h>
 #include <xrpld/app/ledger/LedgerToJson.h>
+#include <xrpld/app/ledger/LoanIndex.h>
 #include <xrpld/app/ledger/OpenLedger.h>
 #include <xrpld/app/ledger/OrderBookDB.h>
 #include <xrpld/app/ledger/PendingSaves.h>
@@ -190,6 +192,8 @@ public:
     NodeFamily nodeFamily_;
     // VFALCO TODO Make OrderBookDB abstract
     OrderBookDB m_orderBookDB;
+    LoanIndex m_loanIndex;
+    LedgerSnapshots m_ledgerSnapshots;
     std::unique_ptr<PathRequests> m_pathRequests;
     std::unique_ptr<LedgerMaster> m_ledgerMaster;
     std::unique_ptr<LedgerCleaner> ledgerCleaner_;
@@ -320,7 +324,9 @@ public:
               *logs_,
               *perfLog_))
 
-        , m_nodeStoreScheduler(*m_jobQueue)
+        , m_nodeStoreScheduler(
+              *m_jobQueue,
+              m_collectorManager->group("nodestore"))
 
         , m_shaMapStore(make_SHAMapStore(
               *this,
@@ -354,6 +360,10 @@ public:
 
         , m_orderBookDB(*this)
 
+        , m_loanIndex(*this)
+
+        , m_ledgerSnapshots(*this)
+
         , m_pathRequests(std::make_unique<PathRequests>(
               *this,
               logs_->journal("PathRequest"),
@@ -623,6 +633,12 @@ public:
         return *m_ledgerReplayer;
     }
 
+    LedgerSnapshots&
+    getLedgerSnapshots() override
+    {
+        return m_ledgerSnapshots;
+    }
+
     InboundLedgers&
     getInboundLedgers() override
     {
@@ -696,6 +712,12 @@ public:
         return m_orderBookDB;
     }
 
+    LoanIndex&
+    getLoanIndex() override
+    {
+        return m_loanIndex;
+    }
+
     PathRequests&
     getPathRequests() override
     {
@@ -1019,6 +1041,9 @@ public:
             // Does not appear to have an associated cache.
             getNodeStore().sweep();
         }
+        {
+            m_ledgerSnapshots.sweep();
+        }
         {
             std::size_t const oldLedgerMasterCacheSize =
                 getLedgerMaster().getFetchPackCacheSize();
@@ -1321,6 +1346,8 @@ ApplicationImp::setup(boost::program_options::variables_map const& cmdline)
 
     m_orderBookDB.setup(getLedgerMaster().getCurrentLedger());
 
+    m_ledgerSnapshots.load();
+
     nodeIdentity_ = getNodeIdentity(*this, cmdline);
 
     if (!cluster_->load(config().section(SECTION_CLUSTER_NODES)))
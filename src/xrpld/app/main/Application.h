@@ -78,11 +78,13 @@ class Ledger;
 class LedgerMaster;
 class LedgerCleaner;
 class LedgerReplayer;
+class LedgerSnapshots;
 class LoadManager;
 class ManifestCache;
 class ValidatorKeys;
 class NetworkOPs;
 class OpenLedger;
+class LoanIndex;
 class OrderBookDB;
 class Overlay;
 class PathRequests;
@@ -219,10 +221,14 @@ public:
     getLedgerCleaner() = 0;
     virtual LedgerReplayer&
     getLedgerReplayer() = 0;
+    virtual LedgerSnapshots&
+    getLedgerSnapshots() = 0;
     virtual NetworkOPs&
     getOPs() = 0;
     virtual OrderBookDB&
     getOrderBookDB() = 0;
+    virtual LoanIndex&
+    getLoanIndex() = 0;
     virtual ServerHandler&
     getServerHandler() = 0;
     virtual TransactionMaster&
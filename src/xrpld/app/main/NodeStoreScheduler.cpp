@@ -21,7 +21,10 @@
 
 namespace ripple {
 
-NodeStoreScheduler::NodeStoreScheduler(JobQueue& jobQueue) : jobQueue_(jobQueue)
+NodeStoreScheduler::NodeStoreScheduler(
+    JobQueue& jobQueue,
+    beast::insight::Collector::ptr const& collector)
+    : jobQueue_(jobQueue), collector_(collector)
 {
 }
 
@@ -63,4 +66,10 @@ NodeStoreScheduler::onBatchWrite(NodeStore::BatchWriteReport const& report)
     jobQueue_.addLoadEvents(jtNS_WRITE, report.writeCount, report.elapsed);
 }
 
+beast::insight::Collector::ptr
+NodeStoreScheduler::collector()
+{
+    return collector_;
+}
+
 }  // namespace ripple
@@ -29,7 +29,9 @@ namespace ripple {
 class NodeStoreScheduler : public NodeStore::Scheduler
 {
 public:
-    explicit NodeStoreScheduler(JobQueue& jobQueue);
+    NodeStoreScheduler(
+        JobQueue& jobQueue,
+        beast::insight::Collector::ptr const& collector);
 
     void
     scheduleTask(NodeStore::Task& task) override;
@@ -37,9 +39,12 @@ public:
     onFetch(NodeStore::FetchReport const& report) override;
     void
     onBatchWrite(NodeStore::BatchWriteReport const& report) override;
+    beast::insight::Collector::ptr
+    collector() override;
 
 private:
     JobQueue& jobQueue_;
+    beast::insight::Collector::ptr const collector_;
 };
 
 }  // namespace ripple
@@ -23,6 +23,10 @@
 #include <xrpl/ledger/View.h>
 #include <xrpl/protocol/st.h>
 
+#include <map>
+#include <optional>
+#include <tuple>
+
 namespace ripple {
 
 struct PreflightContext;
@@ -34,6 +38,76 @@ checkLendingProtocolDependencies(PreflightContext const& ctx);
 Number
 loanPeriodicRate(TenthBips32 interestRate, std::uint32_t paymentInterval);
 
+/** Memoizes loan rate computations for the duration of one ledger.
+ *
+ * LoanSet and LoanPay transactions that use the same loan terms compute the
+ * same periodic rate, and the same raised rates
+ * (1 + periodicRate) ^ paymentsRemaining, over and over. Those values only
+ * depend on their inputs and on the Number rounding mode, so memoizing them
+ * yields exactly the same results.
+ *
+ * Like the Number rounding mode, the cache belongs to the calling thread. It is
+ * only consulted while a LoanRateCache::Scope is alive, and a Scope created
+ * for a view of a different ledger than the previous one clears it, which
+ * ties the lifetime of the cached values to the ledger being built.
+ */
+class LoanRateCache
+{
+    using RateKey =
+        std::tuple<std::uint32_t, std::uint32_t, Number::rounding_mode>;
+    using RaisedKey = std::tuple<Number, std::uint32_t, Number::rounding_mode>;
+
+    // Limits the memory used by a ledger with many distinct loan terms
+    static constexpr std::size_t maxEntries = 4096;
+
+    std::optional<std::pair<LedgerIndex, uint256>> ledger_;
+    std::map<RateKey, Number> periodicRates_;
+    std::map<RaisedKey, Number> raisedRates_;
+
+    static LoanRateCache*&
+    current();
+
+public:
+    /** Enables the calling thread's cache while in scope. */
+    class Scope
+    {
+        LoanRateCache* saved_;
+
+    public:
+        explicit Scope(ReadView const& view);
+        ~Scope();
+
+        Scope(Scope const&) = delete;
+        Scope&
+        operator=(Scope const&) = delete;
+    };
+
+    /// Returns the cache of the calling thread, or nullptr if no Scope is
+    /// alive
+    static LoanRateCache*
+    active();
+
+    Number
+    periodicRate(TenthBips32 interestRate, std::uint32_t paymentInterval);
+
+    std::optional<Number>
+    findRaisedRate(Number const& periodicRate, std::uint32_t paymentsRemaining)
+        const;
+
+    void
+    insertRaisedRate(
+        Number const& periodicRate,
+        std::uint32_t paymentsRemaining,
+        Number const& raisedRate);
+
+    /// Returns the number of memoized values
+    std::size_t
+    size() const
+    {
+        return periodicRates_.size() + raisedRates_.size();
+    }
+};
+
 /// Ensure the periodic payment is always rounded consistently
 inline Number
 roundPeriodicPayment(
@@ -164,6 +238,10 @@ namespace detail {
 // These classes and functions should only be accessed by LendingHelper
 // functions and unit tests
 
+/// Computes the periodic rate without consulting the LoanRateCache
+Number
+computePeriodicRate(TenthBips32 interestRate, std::uint32_t paymentInterval);
+
 enum class PaymentSpecialCase { none, final, extra };
 
 /// This structure is used internally to compute the breakdown of a
@@ -191,6 +269,69 @@ struct PaymentComponents
     trackedInterestPart() const;
 };
 
+/** Amortization table for the installments of a single set of loan terms.
+ *
+ * The raw (unrounded) state of a loan only depends on the periodic payment,
+ * the periodic rate, the management fee rate, and the number of payments
+ * remaining. When a single LoanPay covers several installments, the raw state
+ * is needed for every value of paymentRemaining from N down to N - k + 1,
+ * and each of those needs (1 + periodicRate) ^ paymentRemaining.
+ *
+ * The table memoizes every intermediate power computed by the
+ * square-and-multiply steps of power(Number, unsigned), so
+ * consecutive installments share most of their multiplications. The
+ * operations performed for any given exponent are exactly the ones power()
+ * would perform, so the results are bit-for-bit identical to
+ * calculateRawLoanState, as long as the Number rounding mode does not change
+ * while the table is in use.
+ *
+ * A closed-form sum over k installments is deliberately not used: every
+ * installment rounds its tracked parts against the current rounded state of
+ * the loan, so only the raw parts can be shared between installments.
+ */
+class LoanAmortizationTable
+{
+    Number periodicPayment_;
+    Number periodicRate_;
+    TenthBips16 managementFeeRate_;
+    // 1 + periodicRate, the base of every raised rate
+    Number base_;
+    // Memoized base_ ^ n, keyed by n
+    std::map<std::uint32_t, Number> powers_;
+
+public:
+    LoanAmortizationTable(
+        Number const& periodicPayment,
+        Number const& periodicRate,
+        TenthBips16 managementFeeRate);
+
+    Number const&
+    periodicPayment() const
+    {
+        return periodicPayment_;
+    }
+
+    Number const&
+    periodicRate() const
+    {
+        return periodicRate_;
+    }
+
+    TenthBips16
+    managementFeeRate() const
+    {
+        return managementFeeRate_;
+    }
+
+    /// Returns (1 + periodicRate) ^ paymentRemaining
+    Number const&
+    raisedRate(std::uint32_t paymentRemaining);
+
+    /// Equivalent to calculateRawLoanState with the table's terms
+    LoanState
+    rawState(std::uint32_t paymentRemaining);
+};
+
 PaymentComponents
 computePaymentComponents(
     Asset const& asset,
@@ -203,6 +344,19 @@ computePaymentComponents(
     std::uint32_t paymentRemaining,
     TenthBips16 managementFeeRate);
 
+/** Same as above, but takes the loan terms and the raw loan state from a
+ * LoanAmortizationTable shared by consecutive installments.
+ */
+PaymentComponents
+computePaymentComponents(
+    Asset const& asset,
+    std::int32_t scale,
+    Number const& totalValueOutstanding,
+    Number const& principalOutstanding,
+    Number const& managementFeeOutstanding,
+    std::uint32_t paymentRemaining,
+    LoanAmortizationTable& table);
+
 }  // namespace detail
 
 Number
@@ -224,6 +378,52 @@ computeLoanProperties(
 bool
 isRounded(Asset const& asset, Number const& value, std::int32_t scale);
 
+/** Returns the date the next payment is due once an impaired loan is
+ * unimpaired, as of the parent close time of the view.
+ */
+std::uint32_t
+loanUnimpairedDueDate(ReadView const& view, SLE::const_ref loan);
+
+/** A payment a LoanPay could make, and how it would be applied.
+ */
+struct LoanPaymentQuote
+{
+    /// The smallest amount the payment accepts
+    Number totalDue;
+    /// How totalDue would be split between principal, interest and fees
+    LoanPaymentParts parts;
+};
+
+/** The derived state of a loan as of the parent close time of a view, and
+ * the payments a LoanPay applied to that view would accept.
+ *
+ * This is computed by the same code as LoanPay, so clients do not have to
+ * reimplement the amortization, late payment and full payment math.
+ */
+struct LoanAmountsDue
+{
+    /// The rounded state of the loan, as tracked by the Loan object
+    LoanState state;
+    /// The date the next payment is due, if any. For an impaired loan, this
+    /// is the date that applies once a payment unimpairs it.
+    std::optional<std::uint32_t> nextDueDate;
+    /// Whether the next payment is late
+    bool late = false;
+    /// The next periodic payment, including the late fee and late interest if
+    /// it is late. Unset if the loan is paid off.
+    std::optional<LoanPaymentQuote> nextPayment;
+    /// A payment of the entire loan. Unset if at most one payment remains,
+    /// because the last payment has to be a periodic payment.
+    std::optional<LoanPaymentQuote> fullPayment;
+};
+
+LoanAmountsDue
+computeLoanAmountsDue(
+    Asset const& asset,
+    ReadView const& view,
+    SLE::const_ref loan,
+    SLE::const_ref brokerSle);
+
 Expected<LoanPaymentParts, TER>
 loanMakeFullPayment(
     Asset const& asset,
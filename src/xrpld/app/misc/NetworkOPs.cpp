@@ -23,6 +23,7 @@
 #include <xrpld/app/ledger/InboundLedgers.h>
 #include <xrpld/app/ledger/LedgerMaster.h>
 #include <xrpld/app/ledger/LedgerToJson.h>
+#include <xrpld/app/ledger/LoanIndex.h>
 #include <xrpld/app/ledger/LocalTxs.h>
 #include <xrpld/app/ledger/OpenLedger.h>
 #include <xrpld/app/ledger/OrderBookDB.h>
@@ -3115,6 +3116,8 @@ NetworkOPsImp::pubLedger(std::shared_ptr<ReadView const> const& lpAccepted)
         alpAccepted->getLedger().get() == lpAccepted.get(),
         "ripple::NetworkOPsImp::pubLedger : accepted input");
 
+    app_.getLoanIndex().update(alpAccepted);
+
     {
         JLOG(m_journal.debug())
             << "Publishing ledger " << lpAccepted->info().seq << " "
@@ -327,7 +327,7 @@ SHAMapStoreImp::run()
 
             try
             {
-                validatedLedger->stateMap().snapShot(false)->visitNodes(
+                validatedLedger->stateMap().snapShot(false)->visitNodesBatched(
                     std::bind(
                         &SHAMapStoreImp::copyNode,
                         this,
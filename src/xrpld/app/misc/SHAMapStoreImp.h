@@ -175,7 +175,7 @@ public:
     minimumOnline() const override;
 
 private:
-    // callback for visitNodes
+    // callback for visitNodesBatched
     bool
     copyNode(std::uint64_t& nodeCount, SHAMapTreeNode const& node);
     void
@@ -54,8 +54,10 @@ LoanPaymentParts::operator+=(LoanPaymentParts const& other)
     return *this;
 }
 
+namespace detail {
+
 Number
-loanPeriodicRate(TenthBips32 interestRate, std::uint32_t paymentInterval)
+computePeriodicRate(TenthBips32 interestRate, std::uint32_t paymentInterval)
 {
     // Need floating point math for this one, since we're dividing by some
     // large numbers
@@ -68,6 +70,97 @@ loanPeriodicRate(TenthBips32 interestRate, std::uint32_t paymentInterval)
         (365 * 24 * 60 * 60);
 }
 
+}  // namespace detail
+
+Number
+loanPeriodicRate(TenthBips32 interestRate, std::uint32_t paymentInterval)
+{
+    if (auto const cache = LoanRateCache::active())
+        return cache->periodicRate(interestRate, paymentInterval);
+    return detail::computePeriodicRate(interestRate, paymentInterval);
+}
+
+LoanRateCache*&
+LoanRateCache::current()
+{
+    thread_local LoanRateCache* cache = nullptr;
+    return cache;
+}
+
+LoanRateCache::Scope::Scope(ReadView const& view) : saved_(current())
+{
+    thread_local LoanRateCache cache;
+
+    std::pair<LedgerIndex, uint256> const ledger{
+        view.seq(), view.info().parentHash};
+    if (cache.ledger_ != ledger)
+    {
+        cache.ledger_ = ledger;
+        cache.periodicRates_.clear();
+        cache.raisedRates_.clear();
+    }
+    current() = &cache;
+}
+
+LoanRateCache::Scope::~Scope()
+{
+    current() = saved_;
+}
+
+LoanRateCache*
+LoanRateCache::active()
+{
+    return current();
+}
+
+Number
+LoanRateCache::periodicRate(
+    TenthBips32 interestRate,
+    std::uint32_t paymentInterval)
+{
+    RateKey const key{
+        interestRate.value(), paymentInterval, Number::getround()};
+    if (auto const it = periodicRates_.find(key); it != periodicRates_.end())
+        return it->second;
+
+    if (size() >= maxEntries)
+    {
+        periodicRates_.clear();
+        raisedRates_.clear();
+    }
+    Number const rate =
+        detail::computePeriodicRate(interestRate, paymentInterval);
+    return periodicRates_.emplace(key, rate).first->second;
+}
+
+std::optional<Number>
+LoanRateCache::findRaisedRate(
+    Number const& periodicRate,
+    std::uint32_t paymentsRemaining) const
+{
+    if (auto const it = raisedRates_.find(
+            RaisedKey{periodicRate, paymentsRemaining, Number::getround()});
+        it != raisedRates_.end())
+        return it->second;
+    return std::nullopt;
+}
+
+void
+LoanRateCache::insertRaisedRate(
+    Number const& periodicRate,
+    std::uint32_t paymentsRemaining,
+    Number const& raisedRate)
+{
+    if (size() >= maxEntries)
+    {
+        periodicRates_.clear();
+        raisedRates_.clear();
+    }
+    raisedRates_.emplace(
+        RaisedKey{periodicRate, paymentsRemaining, Number::getround()},
+        raisedRate);
+}
+
 bool
 isRounded(Asset const& asset, Number const& value, std::int32_t scale)
 {
@@ -84,7 +177,30 @@ computeRaisedRate(Number const& periodicRate, std::uint32_t paymentsRemaining)
      * This formula is from the XLS-66 spec, section 3.2.4.1.1 (Regular
      * Payment), though "raisedRate" is computed only once and used twice.
      */
-    return power(1 + periodicRate, paymentsRemaining);
+    auto const cache = LoanRateCache::active();
+    if (cache)
+    {
+        if (auto const raisedRate =
+                cache->findRaisedRate(periodicRate, paymentsRemaining))
+            return *raisedRate;
+    }
+
+    Number const raisedRate = power(1 + periodicRate, paymentsRemaining);
+    if (cache)
+        cache->insertRaisedRate(periodicRate, paymentsRemaining, raisedRate);
+    return raisedRate;
+}
+
+Number
+computePaymentFactorFromRaisedRate(
+    Number const& periodicRate,
+    Number const& raisedRate)
+{
+    /*
+     * This formula is from the XLS-66 spec, section 3.2.4.1.1 (Regular
+     * Payment).
+     */
+    return (periodicRate * raisedRate) / (raisedRate - 1);
 }
 
 Number
@@ -96,10 +212,8 @@ computePaymentFactor(
      * This formula is from the XLS-66 spec, section 3.2.4.1.1 (Regular
      * Payment), though "raisedRate" is computed only once and used twice.
      */
-    Number const raisedRate =
-        computeRaisedRate(periodicRate, paymentsRemaining);
-
-    return (periodicRate * raisedRate) / (raisedRate - 1);
+    return computePaymentFactorFromRaisedRate(
+        periodicRate, computeRaisedRate(periodicRate, paymentsRemaining));
 }
 
 Number
@@ -159,6 +273,94 @@ loanPrincipalFromPeriodicPayment(
         computePaymentFactor(periodicRate, paymentsRemaining);
 }
 
+LoanState
+rawLoanStateFromPrincipal(
+    Number const& periodicPayment,
+    Number const& rawPrincipalOutstanding,
+    std::uint32_t const paymentRemaining,
+    TenthBips16 const managementFeeRate)
+{
+    Number const rawValueOutstanding = periodicPayment * paymentRemaining;
+    Number const rawInterestOutstanding =
+        rawValueOutstanding - rawPrincipalOutstanding;
+    Number const rawManagementFeeOutstanding =
+        tenthBipsOfValue(rawInterestOutstanding, managementFeeRate);
+
+    return LoanState{
+        .valueOutstanding = rawValueOutstanding,
+        .principalOutstanding = rawPrincipalOutstanding,
+        .interestOutstanding = rawInterestOutstanding,
+        .interestDue = rawInterestOutstanding - rawManagementFeeOutstanding,
+        .managementFeeDue = rawManagementFeeOutstanding};
+}
+
+LoanAmortizationTable::LoanAmortizationTable(
+    Number const& periodicPayment,
+    Number const& periodicRate,
+    TenthBips16 managementFeeRate)
+    : periodicPayment_(periodicPayment)
+    , periodicRate_(periodicRate)
+    , managementFeeRate_(managementFeeRate)
+    , base_(1 + periodicRate)
+{
+}
+
+Number const&
+LoanAmortizationTable::raisedRate(std::uint32_t paymentRemaining)
+{
+    if (auto const it = powers_.find(paymentRemaining); it != powers_.end())
+        return it->second;
+
+    auto const cache = LoanRateCache::active();
+    if (cache)
+    {
+        if (auto const raisedRate =
+                cache->findRaisedRate(periodicRate_, paymentRemaining))
+            return powers_.emplace(paymentRemaining, *raisedRate)
+                .first->second;
+    }
+
+    // Follow the same steps as power(Number, unsigned) so that every
+    // intermediate result, and therefore the rounding of every step, matches
+    // computeRaisedRate exactly.
+    Number r;
+    if (paymentRemaining == 0)
+        r = power(base_, 0);
+    else if (paymentRemaining == 1)
+        r = base_;
+    else
+    {
+        r = raisedRate(paymentRemaining / 2);
+        r *= r;
+        if (paymentRemaining % 2 != 0)
+            r *= base_;
+    }
+    if (cache)
+        cache->insertRaisedRate(periodicRate_, paymentRemaining, r);
+    return powers_.emplace(paymentRemaining, r).first->second;
+}
+
+LoanState
+LoanAmortizationTable::rawState(std::uint32_t paymentRemaining)
+{
+    if (paymentRemaining == 0)
+        return calculateRawLoanState(
+            periodicPayment_, periodicRate_, 0, managementFeeRate_);
+
+    // Same as loanPrincipalFromPeriodicPayment, but with a shared raised rate
+    Number const rawPrincipalOutstanding = periodicRate_ == 0
+        ? periodicPayment_ * paymentRemaining
+        : periodicPayment_ /
+            computePaymentFactorFromRaisedRate(
+                periodicRate_, raisedRate(paymentRemaining));
+
+    return rawLoanStateFromPrincipal(
+        periodicPayment_,
+        rawPrincipalOutstanding,
+        paymentRemaining,
+        managementFeeRate_);
+}
+
 std::pair<Number, Number>
 computeInterestAndFeeParts(
     Number const& interest,
@@ -186,7 +388,9 @@ loanLatePaymentInterest(
     auto const secondsOverdue =
         parentCloseTime.time_since_epoch().count() - nextPaymentDueDate;
 
-    auto const rate = loanPeriodicRate(lateInterestRate, secondsOverdue);
+    // The overdue time is different for nearly every payment, so don't
+    // bother memoizing this rate.
+    auto const rate = computePeriodicRate(lateInterestRate, secondsOverdue);
 
     return principalOutstanding * rate;
 }
@@ -475,6 +679,19 @@ struct PaymentComponentsPlus : public PaymentComponents
     }
 };
 
+/// Combine the tracked and untracked parts of a payment
+LoanPaymentParts
+toPaymentParts(PaymentComponentsPlus const& payment)
+{
+    return LoanPaymentParts{
+        .principalPaid = payment.trackedPrincipalDelta,
+        .interestPaid =
+            payment.trackedInterestPart() + payment.untrackedInterest,
+        .valueChange = payment.untrackedInterest,
+        .feePaid =
+            payment.trackedManagementFeeDelta + payment.untrackedManagementFee};
+}
+
 template <class NumberProxy, class UInt32Proxy, class UInt32OptionalProxy>
 LoanPaymentParts
 doPayment(
@@ -564,17 +781,8 @@ doPayment(
         "ripple::detail::doPayment",
         "fee outstanding stays valid");
 
-    return LoanPaymentParts{
-        .principalPaid = payment.trackedPrincipalDelta,
-        // Now that the Loan object has been updated, the tracked interest
-        // (computed here) and untracked interest can be combined.
-        .interestPaid =
-            payment.trackedInterestPart() + payment.untrackedInterest,
-        .valueChange = payment.untrackedInterest,
-        // Now that the Loan object has been updated, the fee parts can be
-        // combined
-        .feePaid =
-            payment.trackedManagementFeeDelta + payment.untrackedManagementFee};
+    // Now that the Loan object has been updated, the parts can be combined
+    return toPaymentParts(payment);
 }
 
 // This function mainly exists to guarantee isolation of the "sandbox"
@@ -799,13 +1007,9 @@ computeInterestAndFeeParts(
     return std::make_pair(interest - fee, fee);
 }
 
-/** Handle possible late payments.
- *
- * If this function processed a late payment, the return value will be
- * a LoanPaymentParts object. If the loan is not late, the return will be an
- * Unexpected(tesSUCCESS). Otherwise, it'll be an Unexpected with the error code
- * the caller is expected to return.
+/** Compute the components of a late payment, without checking the amount.
  *
+ * Returns std::nullopt if the payment is not late.
  *
  * This function is an implementation of the XLS-66 spec, based on
  * * section 3.2.4.3 (Transaction Pseudo-code), specifically the bit
@@ -813,22 +1017,20 @@ computeInterestAndFeeParts(
  * * section 3.2.4.1.2 (Late Payment)
  */
 
-Expected<PaymentComponentsPlus, TER>
-computeLatePayment(
+std::optional<PaymentComponentsPlus>
+computeLatePaymentComponents(
     Asset const& asset,
-    ApplyView const& view,
+    ReadView const& view,
     Number const& principalOutstanding,
     std::int32_t nextDueDate,
     PaymentComponentsPlus const& periodic,
     TenthBips32 lateInterestRate,
     std::int32_t loanScale,
     Number const& latePaymentFee,
-    STAmount const& amount,
-    TenthBips16 managementFeeRate,
-    beast::Journal j)
+    TenthBips16 managementFeeRate)
 {
     if (!hasExpired(view, nextDueDate))
-        return Unexpected(tesSUCCESS);
+        return std::nullopt;
 
     // the payment is late
     // Late payment interest is only the part of the interest that comes
@@ -850,10 +1052,10 @@ computeLatePayment(
 
     XRPL_ASSERT(
         roundedLateInterest >= 0,
-        "ripple::detail::computeLatePayment : valid late interest");
+        "ripple::detail::computeLatePaymentComponents : valid late interest");
     XRPL_ASSERT_PARTS(
         periodic.specialCase != PaymentSpecialCase::extra,
-        "ripple::detail::computeLatePayment",
+        "ripple::detail::computeLatePaymentComponents",
         "no extra parts to this payment");
     // Copy the periodic payment values, and add on the late interest.
     // This preserves all the other fields without having to enumerate them.
@@ -873,31 +1075,67 @@ computeLatePayment(
 
     XRPL_ASSERT_PARTS(
         isRounded(asset, late.totalDue, loanScale),
-        "ripple::detail::computeLatePayment",
+        "ripple::detail::computeLatePaymentComponents",
         "total due is rounded");
 
-    if (amount < late.totalDue)
+    return late;
+}
+
+/** Handle possible late payments.
+ *
+ * If this function processed a late payment, the return value will be
+ * a LoanPaymentParts object. If the loan is not late, the return will be an
+ * Unexpected(tesSUCCESS). Otherwise, it'll be an Unexpected with the error code
+ * the caller is expected to return.
+ */
+
+Expected<PaymentComponentsPlus, TER>
+computeLatePayment(
+    Asset const& asset,
+    ApplyView const& view,
+    Number const& principalOutstanding,
+    std::int32_t nextDueDate,
+    PaymentComponentsPlus const& periodic,
+    TenthBips32 lateInterestRate,
+    std::int32_t loanScale,
+    Number const& latePaymentFee,
+    STAmount const& amount,
+    TenthBips16 managementFeeRate,
+    beast::Journal j)
+{
+    auto const late = computeLatePaymentComponents(
+        asset,
+        view,
+        principalOutstanding,
+        nextDueDate,
+        periodic,
+        lateInterestRate,
+        loanScale,
+        latePaymentFee,
+        managementFeeRate);
+    if (!late)
+        return Unexpected(tesSUCCESS);
+
+    if (amount < late->totalDue)
     {
         JLOG(j.warn()) << "Late loan payment amount is insufficient. Due: "
-                       << late.totalDue << ", paid: " << amount;
+                       << late->totalDue << ", paid: " << amount;
         return Unexpected(tecINSUFFICIENT_PAYMENT);
     }
 
-    return late;
+    return *late;
 }
 
-/* Handle possible full payments.
+/** Compute the components of a full payment, without checking the amount.
  *
- * If this function processed a full payment, the return value will be
- * a PaymentComponentsPlus object. Otherwise, it'll be an Unexpected with the
- * error code the caller is expected to return. It should NEVER return
- * tesSUCCESS
+ * Returns std::nullopt if at most one payment remains, because the last
+ * payment has to be a regular payment.
  */
 
-Expected<PaymentComponentsPlus, TER>
-computeFullPayment(
+std::optional<PaymentComponentsPlus>
+computeFullPaymentComponents(
     Asset const& asset,
-    ApplyView& view,
+    ReadView const& view,
     Number const& principalOutstanding,
     Number const& managementFeeOutstanding,
     Number const& periodicPayment,
@@ -910,13 +1148,10 @@ computeFullPayment(
     Number const& totalInterestOutstanding,
     Number const& periodicRate,
     Number const& closePaymentFee,
-    STAmount const& amount,
-    TenthBips16 managementFeeRate,
-    beast::Journal j)
+    TenthBips16 managementFeeRate)
 {
     if (paymentRemaining <= 1)
-        // If this is the last payment, it has to be a regular payment
-        return Unexpected(tecKILLED);
+        return std::nullopt;
 
     Number const rawPrincipalOutstanding = loanPrincipalFromPeriodicPayment(
         periodicPayment, periodicRate, paymentRemaining);
@@ -971,15 +1206,66 @@ computeFullPayment(
 
     XRPL_ASSERT_PARTS(
         isRounded(asset, full.totalDue, loanScale),
-        "ripple::detail::computeFullPayment",
+        "ripple::detail::computeFullPaymentComponents",
         "total due is rounded");
 
-    if (amount < full.totalDue)
+    return full;
+}
+
+/* Handle possible full payments.
+ *
+ * If this function processed a full payment, the return value will be
+ * a PaymentComponentsPlus object. Otherwise, it'll be an Unexpected with the
+ * error code the caller is expected to return. It should NEVER return
+ * tesSUCCESS
+ */
+
+Expected<PaymentComponentsPlus, TER>
+computeFullPayment(
+    Asset const& asset,
+    ApplyView& view,
+    Number const& principalOutstanding,
+    Number const& managementFeeOutstanding,
+    Number const& periodicPayment,
+    std::uint32_t paymentRemaining,
+    std::uint32_t prevPaymentDate,
+    std::uint32_t const startDate,
+    std::uint32_t const paymentInterval,
+    TenthBips32 const closeInterestRate,
+    std::int32_t loanScale,
+    Number const& totalInterestOutstanding,
+    Number const& periodicRate,
+    Number const& closePaymentFee,
+    STAmount const& amount,
+    TenthBips16 managementFeeRate,
+    beast::Journal j)
+{
+    auto const full = computeFullPaymentComponents(
+        asset,
+        view,
+        principalOutstanding,
+        managementFeeOutstanding,
+        periodicPayment,
+        paymentRemaining,
+        prevPaymentDate,
+        startDate,
+        paymentInterval,
+        closeInterestRate,
+        loanScale,
+        totalInterestOutstanding,
+        periodicRate,
+        closePaymentFee,
+        managementFeeRate);
+    if (!full)
+        // If this is the last payment, it has to be a regular payment
+        return Unexpected(tecKILLED);
+
+    if (amount < full->totalDue)
         // If the payment is less than the full payment amount, it's not
         // sufficient to be a full payment, but that's not an error.
         return Unexpected(tecINSUFFICIENT_PAYMENT);
 
-    return full;
+    return *full;
 }
 
 Number
@@ -999,7 +1285,8 @@ computePaymentComponents(
     Number const& periodicPayment,
     Number const& periodicRate,
     std::uint32_t paymentRemaining,
-    TenthBips16 managementFeeRate)
+    TenthBips16 managementFeeRate,
+    LoanState const& raw)
 {
     /*
      * This function is derived from the XLS-66 spec, section 3.2.4.1.1 (Regular
@@ -1014,9 +1301,6 @@ computePaymentComponents(
     auto const roundedPeriodicPayment =
         roundPeriodicPayment(asset, periodicPayment, scale);
 
-    LoanState const raw = calculateRawLoanState(
-        periodicPayment, periodicRate, paymentRemaining, managementFeeRate);
-
     if (paymentRemaining == 1 ||
         totalValueOutstanding <= roundedPeriodicPayment)
     {
@@ -1138,6 +1422,58 @@ computePaymentComponents(
     };
 }
 
+PaymentComponents
+computePaymentComponents(
+    Asset const& asset,
+    std::int32_t scale,
+    Number const& totalValueOutstanding,
+    Number const& principalOutstanding,
+    Number const& managementFeeOutstanding,
+    Number const& periodicPayment,
+    Number const& periodicRate,
+    std::uint32_t paymentRemaining,
+    TenthBips16 managementFeeRate)
+{
+    return computePaymentComponents(
+        asset,
+        scale,
+        totalValueOutstanding,
+        principalOutstanding,
+        managementFeeOutstanding,
+        periodicPayment,
+        periodicRate,
+        paymentRemaining,
+        managementFeeRate,
+        calculateRawLoanState(
+            periodicPayment,
+            periodicRate,
+            paymentRemaining,
+            managementFeeRate));
+}
+
+PaymentComponents
+computePaymentComponents(
+    Asset const& asset,
+    std::int32_t scale,
+    Number const& totalValueOutstanding,
+    Number const& principalOutstanding,
+    Number const& managementFeeOutstanding,
+    std::uint32_t paymentRemaining,
+    LoanAmortizationTable& table)
+{
+    return computePaymentComponents(
+        asset,
+        scale,
+        totalValueOutstanding,
+        principalOutstanding,
+        managementFeeOutstanding,
+        table.periodicPayment(),
+        table.periodicRate(),
+        paymentRemaining,
+        table.managementFeeRate(),
+        table.rawState(paymentRemaining));
+}
+
 PaymentComponentsPlus
 computeOverpaymentComponents(
     Asset const& asset,
@@ -1260,21 +1596,12 @@ calculateRawLoanState(
             .interestDue = 0,
             .managementFeeDue = 0};
     }
-    Number const rawValueOutstanding = periodicPayment * paymentRemaining;
-    Number const rawPrincipalOutstanding =
+    return detail::rawLoanStateFromPrincipal(
+        periodicPayment,
         detail::loanPrincipalFromPeriodicPayment(
-            periodicPayment, periodicRate, paymentRemaining);
-    Number const rawInterestOutstanding =
-        rawValueOutstanding - rawPrincipalOutstanding;
-    Number const rawManagementFeeOutstanding =
-        tenthBipsOfValue(rawInterestOutstanding, managementFeeRate);
-
-    return LoanState{
-        .valueOutstanding = rawValueOutstanding,
-        .principalOutstanding = rawPrincipalOutstanding,
-        .interestOutstanding = rawInterestOutstanding,
-        .interestDue = rawInterestOutstanding - rawManagementFeeOutstanding,
-        .managementFeeDue = rawManagementFeeOutstanding};
+            periodicPayment, periodicRate, paymentRemaining),
+        paymentRemaining,
+        managementFeeRate);
 };
 
 LoanState
@@ -1428,6 +1755,124 @@ computeLoanProperties(
         .firstPaymentPrincipal = firstPaymentPrincipal};
 }
 
+std::uint32_t
+loanUnimpairedDueDate(ReadView const& view, SLE::const_ref loan)
+{
+    auto const paymentInterval = loan->at(sfPaymentInterval);
+    auto const normalPaymentDueDate =
+        std::max(loan->at(sfPreviousPaymentDate), loan->at(sfStartDate)) +
+        paymentInterval;
+    if (!hasExpired(view, normalPaymentDueDate))
+    {
+        // loan was unimpaired within the payment interval
+        return normalPaymentDueDate;
+    }
+    // loan was unimpaired after the original payment due date
+    return view.parentCloseTime().time_since_epoch().count() +
+        paymentInterval;
+}
+
+LoanAmountsDue
+computeLoanAmountsDue(
+    Asset const& asset,
+    ReadView const& view,
+    SLE::const_ref loan,
+    SLE::const_ref brokerSle)
+{
+    /*
+     * This follows loanMakePayment and loanMakeFullPayment, but only computes
+     * the payment components, and does not apply them.
+     */
+    LoanAmountsDue result{.state = calculateRoundedLoanState(loan)};
+
+    std::uint32_t const paymentRemaining = loan->at(sfPaymentRemaining);
+    Number const principalOutstanding = loan->at(sfPrincipalOutstanding);
+    if (paymentRemaining == 0 || principalOutstanding == 0)
+        // Loan complete
+        return result;
+
+    // LoanPay unimpairs a loan before computing the payment
+    if (loan->isFlag(lsfLoanImpaired))
+        result.nextDueDate = loanUnimpairedDueDate(view, loan);
+    else
+        result.nextDueDate = loan->at(~sfNextPaymentDueDate);
+    if (!result.nextDueDate)
+        return result;  // LCOV_EXCL_LINE
+
+    std::int32_t const loanScale = loan->at(sfLoanScale);
+
+    TenthBips32 const interestRate{loan->at(sfInterestRate)};
+    TenthBips32 const lateInterestRate{loan->at(sfLateInterestRate)};
+    TenthBips32 const closeInterestRate{loan->at(sfCloseInterestRate)};
+
+    Number const serviceFee = loan->at(sfLoanServiceFee);
+    Number const latePaymentFee = loan->at(sfLatePaymentFee);
+    Number const closePaymentFee =
+        roundToAsset(asset, loan->at(sfClosePaymentFee), loanScale);
+    TenthBips16 const managementFeeRate{brokerSle->at(sfManagementFeeRate)};
+
+    Number const periodicPayment = loan->at(sfPeriodicPayment);
+    std::uint32_t const paymentInterval = loan->at(sfPaymentInterval);
+    Number const periodicRate = loanPeriodicRate(interestRate, paymentInterval);
+
+    auto const& state = result.state;
+    detail::PaymentComponentsPlus const periodic{
+        detail::computePaymentComponents(
+            asset,
+            loanScale,
+            state.valueOutstanding,
+            state.principalOutstanding,
+            state.managementFeeDue,
+            periodicPayment,
+            periodicRate,
+            paymentRemaining,
+            managementFeeRate),
+        serviceFee};
+
+    auto const toQuote = [](detail::PaymentComponentsPlus const& payment) {
+        return LoanPaymentQuote{
+            .totalDue = payment.totalDue,
+            .parts = detail::toPaymentParts(payment)};
+    };
+
+    if (auto const late = detail::computeLatePaymentComponents(
+            asset,
+            view,
+            principalOutstanding,
+            *result.nextDueDate,
+            periodic,
+            lateInterestRate,
+            loanScale,
+            latePaymentFee,
+            managementFeeRate))
+    {
+        result.late = true;
+        result.nextPayment = toQuote(*late);
+    }
+    else
+        result.nextPayment = toQuote(periodic);
+
+    if (auto const full = detail::computeFullPaymentComponents(
+            asset,
+            view,
+            principalOutstanding,
+            state.managementFeeDue,
+            periodicPayment,
+            paymentRemaining,
+            loan->at(sfPreviousPaymentDate),
+            loan->at(sfStartDate),
+            paymentInterval,
+            closeInterestRate,
+            loanScale,
+            state.interestDue,
+            periodicRate,
+            closePaymentFee,
+            managementFeeRate))
+        result.fullPayment = toQuote(*full);
+
+    return result;
+}
+
 Expected<LoanPaymentParts, TER>
 loanMakeFullPayment(
     Asset const& asset,
@@ -1599,6 +2044,11 @@ loanMakePayment(
 
     view.update(loan);
 
+    // Consecutive installments share the loan terms, so share the raw
+    // amortization math between them, too.
+    detail::LoanAmortizationTable amortization{
+        periodicPayment, periodicRate, managementFeeRate};
+
     detail::PaymentComponentsPlus const periodic{
         detail::computePaymentComponents(
             asset,
@@ -1606,10 +2056,8 @@ loanMakePayment(
             totalValueOutstandingProxy,
             principalOutstandingProxy,
             managementFeeOutstandingProxy,
-            periodicPayment,
-            periodicRate,
             paymentRemainingProxy,
-            managementFeeRate),
+            amortization),
         serviceFee};
     XRPL_ASSERT_PARTS(
         periodic.trackedPrincipalDelta >= 0,
@@ -1687,10 +2135,8 @@ loanMakePayment(
                 totalValueOutstandingProxy,
                 principalOutstandingProxy,
                 managementFeeOutstandingProxy,
-                periodicPayment,
-                periodicRate,
                 paymentRemainingProxy,
-                managementFeeRate),
+                amortization),
             serviceFee};
         XRPL_ASSERT_PARTS(
             nextPayment.trackedPrincipalDelta >= 0,
@@ -19,13 +19,68 @@
 
 #include <xrpld/app/tx/detail/ApplyContext.h>
 #include <xrpld/app/tx/detail/InvariantCheck.h>
+#include <xrpld/core/JobQueue.h>
 
 #include <xrpl/basics/Log.h>
+#include <xrpl/basics/Number.h>
+#include <xrpl/beast/type_name.h>
 #include <xrpl/beast/utility/instrumentation.h>
 #include <xrpl/json/to_string.h>
+#include <xrpl/protocol/IOUAmount.h>
+#include <xrpl/protocol/Rules.h>
+#include <xrpl/protocol/STAmount.h>
+
+#include <chrono>
+#include <functional>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
 
 namespace ripple {
 
+namespace {
+
+// Adds the time until it is destroyed to a running total
+class ScopedTimer
+{
+    using clock = std::chrono::steady_clock;
+
+    clock::duration& total_;
+    clock::time_point const start_ = clock::now();
+
+public:
+    explicit ScopedTimer(clock::duration& total) : total_(total)
+    {
+    }
+
+    ScopedTimer(ScopedTimer const&) = delete;
+    ScopedTimer&
+    operator=(ScopedTimer const&) = delete;
+
+    ~ScopedTimer()
+    {
+        total_ += clock::now() - start_;
+    }
+};
+
+// A ledger entry modified by a transaction
+struct Change
+{
+    bool isDelete;
+    std::shared_ptr<SLE const> before;
+    std::shared_ptr<SLE const> after;
+};
+
+template <std::size_t I>
+std::string
+checkName()
+{
+    return beast::type_name<std::tuple_element_t<I, InvariantChecks>>();
+}
+
+}  // namespace
+
 ApplyContext::ApplyContext(
     Application& app_,
     OpenView& base,
@@ -103,23 +158,108 @@ ApplyContext::checkInvariantsHelper(
     {
         auto checkers = getInvariantChecks();
 
-        // call each check's per-entry method
-        visit([&checkers](
-                  uint256 const& index,
-                  bool isDelete,
-                  std::shared_ptr<SLE const> const& before,
-                  std::shared_ptr<SLE const> const& after) {
-            (..., std::get<Is>(checkers).visitEntry(isDelete, before, after));
-        });
-
-        // Note: do not replace this logic with a `...&&` fold expression.
-        // The fold expression will only run until the first check fails (it
-        // short-circuits). While the logic is still correct, the log
-        // message won't be. Every failed invariant should write to the log,
-        // not just the first one.
-        std::array<bool, sizeof...(Is)> finalizers{
-            {std::get<Is>(checkers).finalize(
-                tx, result, fee, *view_, journal)...}};
+        // The time spent in each check, only measured if it will be logged
+        bool const timed = journal.trace().active();
+        std::array<std::chrono::steady_clock::duration, sizeof...(Is)>
+            elapsed{};
+        auto const measure = [&](std::size_t i, auto const& f) {
+            std::optional<ScopedTimer> timer;
+            if (timed)
+                timer.emplace(elapsed[i]);
+            return f();
+        };
+
+        std::array<bool, sizeof...(Is)> finalizers{};
+
+        auto const& config = app.config();
+        if (config.PARALLEL_INVARIANT_WORKERS > 0 &&
+            view_->size() >= config.PARALLEL_INVARIANT_MIN_ENTRIES)
+        {
+            // Visit the modified entries once, then let each check work
+            // through them on its own. A check only writes its own result,
+            // so the outcome does not depend on the order the checks run in.
+            std::vector<Change> changes;
+            changes.reserve(view_->size());
+            visit([&changes](
+                      uint256 const& index,
+                      bool isDelete,
+                      std::shared_ptr<SLE const> const& before,
+                      std::shared_ptr<SLE const> const& after) {
+                changes.push_back({isDelete, before, after});
+            });
+
+            std::array<std::function<bool()>, sizeof...(Is)> const checks{
+                {[&]() {
+                    return measure(Is, [&]() {
+                        auto& checker = std::get<Is>(checkers);
+                        for (auto const& [isDelete, before, after] : changes)
+                            checker.visitEntry(isDelete, before, after);
+                        return checker.finalize(
+                            tx, result, fee, *view_, journal);
+                    });
+                }...}};
+
+            // The checks depend on state kept per thread, or per coroutine,
+            // which the workers do not share with this thread. Give each
+            // check the state it would have had here, so the results do not
+            // depend on which thread ran it.
+            auto const roundMode = Number::getround();
+            auto const rules = getCurrentTransactionRules();
+            bool const numberSwitchover = getSTNumberSwitchover();
+            bool const amountSwitchover = getSTAmountCanonicalizeSwitchover();
+
+            // If checks throw, the exception of the first check is reported,
+            // as if the checks had run one after another
+            app.getJobQueue().runParallel(
+                jtINVARIANT,
+                "checkInvariants",
+                config.PARALLEL_INVARIANT_WORKERS,
+                checks.size(),
+                [&](std::size_t i) {
+                    NumberRoundModeGuard const roundGuard(roundMode);
+                    NumberSO const numberSO(numberSwitchover);
+                    STAmountSO const amountSO(amountSwitchover);
+                    std::optional<CurrentTransactionRulesGuard> rulesGuard;
+                    if (rules)
+                        rulesGuard.emplace(*rules);
+                    finalizers[i] = checks[i]();
+                });
+        }
+        else
+        {
+            // call each check's per-entry method
+            visit([&](uint256 const& index,
+                      bool isDelete,
+                      std::shared_ptr<SLE const> const& before,
+                      std::shared_ptr<SLE const> const& after) {
+                (...,
+                 measure(Is, [&]() {
+                     std::get<Is>(checkers).visitEntry(isDelete, before, after);
+                 }));
+            });
+
+            // Note: do not replace this logic with a `...&&` fold expression.
+            // The fold expression will only run until the first check fails
+            // (it short-circuits). While the logic is still correct, the log
+            // message won't be. Every failed invariant should write to the
+            // log, not just the first one.
+            finalizers = {{measure(Is, [&]() {
+                return std::get<Is>(checkers).finalize(
+                    tx, result, fee, *view_, journal);
+            })...}};
+        }
+
+        if (timed)
+        {
+            using namespace std::chrono;
+            std::stringstream ss;
+            ss << "Invariant check times for " << tx.getTransactionID()
+               << " (us):";
+            (...,
+             (ss << ' ' << checkName<Is>() << '='
+                 << duration<double, std::micro>(elapsed[Is]).count()));
+            JLOG(journal.trace()) << ss.str();
+        }
 
         // call each check's finalizer to see that it passes
         if (!std::all_of(
@@ -2363,7 +2363,15 @@ ValidLoanBroker::visitEntry(
 {
     if (after && after->getType() == ltLOAN_BROKER)
     {
-        brokers_.emplace_back(before, after);
+        Broker broker;
+        broker.pseudoId = after->at(sfAccount);
+        broker.ownerCount = after->at(sfOwnerCount);
+        if (before)
+            broker.beforeLoanSequence = before->at(sfLoanSequence);
+        broker.loanSequence = after->at(sfLoanSequence);
+        broker.debtTotal = after->at(sfDebtTotal);
+        broker.coverAvailable = after->at(sfCoverAvailable);
+        brokers_.push_back(std::move(broker));
     }
 }
 
@@ -2422,15 +2430,15 @@ ValidLoanBroker::finalize(
     // Loan Brokers will not exist on ledger if the Lending Protocol amendment
     // is not enabled, so there's no need to check it.
 
-    for (auto const& [before, after] : brokers_)
+    for (auto const& broker : brokers_)
     {
         // https://github.com/Tapanito/XRPL-Standards/blob/xls-66-lending-protocol/XLS-0066d-lending-protocol/README.md#3123-invariants
         // If `LoanBroker.OwnerCount = 0` the `DirectoryNode` will have at most
         // one node (the root), which will only hold entries for `RippleState`
         // or `MPToken` objects.
-        if (after->at(sfOwnerCount) == 0)
+        if (broker.ownerCount == 0)
         {
-            auto const dir = view.read(keylet::ownerDir(after->at(sfAccount)));
+            auto const dir = view.read(keylet::ownerDir(broker.pseudoId));
             if (dir)
             {
                 if (!goodZeroDirectory(view, dir, j))
@@ -2439,19 +2447,20 @@ ValidLoanBroker::finalize(
                 }
             }
         }
-        if (before && before->at(sfLoanSequence) > after->at(sfLoanSequence))
+        if (broker.beforeLoanSequence &&
+            *broker.beforeLoanSequence > broker.loanSequence)
         {
             JLOG(j.fatal()) << "Invariant failed: Loan Broker sequence number "
                                "decreased";
             return false;
         }
-        if (after->at(sfDebtTotal) < 0)
+        if (broker.debtTotal < 0)
         {
             JLOG(j.fatal())
                 << "Invariant failed: Loan Broker debt total is negative";
             return false;
         }
-        if (after->at(sfCoverAvailable) < 0)
+        if (broker.coverAvailable < 0)
         {
             JLOG(j.fatal())
                 << "Invariant failed: Loan Broker cover available is negative";
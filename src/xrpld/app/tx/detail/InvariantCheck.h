@@ -29,7 +29,9 @@
 #include <xrpl/protocol/TER.h>
 
 #include <cstdint>
+#include <optional>
 #include <tuple>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace ripple {
@@ -782,9 +784,19 @@ public:
  */
 class ValidLoanBroker
 {
-    // Pair is <before, after>. After is used for most of the checks, except
-    // those that check changed values.
-    std::vector<std::pair<SLE::const_pointer, SLE::const_pointer>> brokers_;
+    // The fields of a modified broker which are checked, read once when the
+    // broker is visited.
+    struct Broker final
+    {
+        AccountID pseudoId = {};
+        std::uint32_t ownerCount = 0;
+        std::optional<std::uint32_t> beforeLoanSequence = {};
+        std::uint32_t loanSequence = 0;
+        Number debtTotal = 0;
+        Number coverAvailable = 0;
+    };
+
+    std::vector<Broker> brokers_;
 
     bool
     goodZeroDirectory(
@@ -233,6 +233,8 @@ LoanPay::doApply()
 {
     auto const& tx = ctx_.tx;
     auto& view = ctx_.view();
+    // Share loan rate computations with other transactions in this ledger
+    LoanRateCache::Scope const rateCache{view};
 
     auto const amount = tx[sfAmount];
 
@@ -323,6 +323,8 @@ LoanSet::doApply()
 {
     auto const& tx = ctx_.tx;
     auto& view = ctx_.view();
+    // Share loan rate computations with other transactions in this ledger
+    LoanRateCache::Scope const rateCache{view};
 
     auto const brokerID = tx[sfLoanBrokerID];
 
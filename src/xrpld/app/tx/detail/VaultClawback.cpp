@@ -178,6 +178,7 @@ VaultClawback::doApply()
     STAmount assetsRecovered;
     try
     {
+        VaultConversion const conversion{*vault, *sleIssuance};
         if (amount == beast::zero)
         {
             sharesDestroyed = accountHolds(
@@ -189,7 +190,7 @@ VaultClawback::doApply()
                 j_);
 
             auto const maybeAssets =
-                sharesToAssetsWithdraw(vault, sleIssuance, sharesDestroyed);
+                sharesToAssetsWithdraw(conversion, sharesDestroyed);
             if (!maybeAssets)
                 return tecINTERNAL;  // LCOV_EXCL_LINE
             assetsRecovered = *maybeAssets;
@@ -199,14 +200,14 @@ VaultClawback::doApply()
             assetsRecovered = amount;
             {
                 auto const maybeShares =
-                    assetsToSharesWithdraw(vault, sleIssuance, assetsRecovered);
+                    assetsToSharesWithdraw(conversion, assetsRecovered);
                 if (!maybeShares)
                     return tecINTERNAL;  // LCOV_EXCL_LINE
                 sharesDestroyed = *maybeShares;
             }
 
             auto const maybeAssets =
-                sharesToAssetsWithdraw(vault, sleIssuance, sharesDestroyed);
+                sharesToAssetsWithdraw(conversion, sharesDestroyed);
             if (!maybeAssets)
                 return tecINTERNAL;  // LCOV_EXCL_LINE
             assetsRecovered = *maybeAssets;
@@ -220,14 +221,14 @@ VaultClawback::doApply()
             // the corresponding assets might breach the AssetsAvailable
             {
                 auto const maybeShares = assetsToSharesWithdraw(
-                    vault, sleIssuance, assetsRecovered, TruncateShares::yes);
+                    conversion, assetsRecovered, TruncateShares::yes);
                 if (!maybeShares)
                     return tecINTERNAL;  // LCOV_EXCL_LINE
                 sharesDestroyed = *maybeShares;
             }
 
             auto const maybeAssets =
-                sharesToAssetsWithdraw(vault, sleIssuance, sharesDestroyed);
+                sharesToAssetsWithdraw(conversion, sharesDestroyed);
             if (!maybeAssets)
                 return tecINTERNAL;  // LCOV_EXCL_LINE
             assetsRecovered = *maybeAssets;
@@ -239,9 +239,9 @@ VaultDeposit::doApply()
     try
     {
         // Compute exchange before transferring any amounts.
+        VaultConversion const conversion{*vault, *sleIssuance};
         {
-            auto const maybeShares =
-                assetsToSharesDeposit(vault, sleIssuance, amount);
+            auto const maybeShares = assetsToSharesDeposit(conversion, amount);
             if (!maybeShares)
                 return tecINTERNAL;  // LCOV_EXCL_LINE
             sharesCreated = *maybeShares;
@@ -250,7 +250,7 @@ VaultDeposit::doApply()
             return tecPRECISION_LOSS;
 
         auto const maybeAssets =
-            sharesToAssetsDeposit(vault, sleIssuance, sharesCreated);
+            sharesToAssetsDeposit(conversion, sharesCreated);
         if (!maybeAssets)
             return tecINTERNAL;  // LCOV_EXCL_LINE
         else if (*maybeAssets > amount)
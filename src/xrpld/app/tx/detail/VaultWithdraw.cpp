@@ -160,12 +160,13 @@ VaultWithdraw::doApply()
     STAmount assetsWithdrawn;
     try
     {
+        VaultConversion const conversion{*vault, *sleIssuance};
         if (amount.asset() == vaultAsset)
         {
             // Fixed assets, variable shares.
             {
                 auto const maybeShares =
-                    assetsToSharesWithdraw(vault, sleIssuance, amount);
+                    assetsToSharesWithdraw(conversion, amount);
                 if (!maybeShares)
                     return tecINTERNAL;  // LCOV_EXCL_LINE
                 sharesRedeemed = *maybeShares;
@@ -174,7 +175,7 @@ VaultWithdraw::doApply()
             if (sharesRedeemed == beast::zero)
                 return tecPRECISION_LOSS;
             auto const maybeAssets =
-                sharesToAssetsWithdraw(vault, sleIssuance, sharesRedeemed);
+                sharesToAssetsWithdraw(conversion, sharesRedeemed);
             if (!maybeAssets)
                 return tecINTERNAL;  // LCOV_EXCL_LINE
             assetsWithdrawn = *maybeAssets;
@@ -184,7 +185,7 @@ VaultWithdraw::doApply()
             // Fixed shares, variable assets.
             sharesRedeemed = amount;
             auto const maybeAssets =
-                sharesToAssetsWithdraw(vault, sleIssuance, sharesRedeemed);
+                sharesToAssetsWithdraw(conversion, sharesRedeemed);
             if (!maybeAssets)
                 return tecINTERNAL;  // LCOV_EXCL_LINE
             assetsWithdrawn = *maybeAssets;
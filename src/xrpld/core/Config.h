@@ -238,6 +238,22 @@ public:
     // Can only be set in code, specifically unit tests
     bool FORCE_MULTI_THREAD = false;
 
+    // Parallel invariant checking. Job queue jobs which help to check the
+    // invariants of transactions modifying at least the given number of
+    // ledger entries. default: 0, checked on the applying thread only
+    int PARALLEL_INVARIANT_WORKERS = 0;
+    std::size_t PARALLEL_INVARIANT_MIN_ENTRIES = 64;
+
+    // Parallel ledger hashing. Job queue jobs which help to hash and write
+    // the subtrees of a ledger's maps. default: 0, hashed on one thread only
+    int PARALLEL_HASH_WORKERS = 0;
+
+    // Batched reads of ledger maps. The most nodes a walk of a map reads from
+    // the node store at once, and the number of threads those reads are
+    // split between. default: 256 nodes, read on one thread
+    std::size_t FETCH_BATCH_SIZE = 256;
+    int FETCH_BATCHES_IN_FLIGHT = 1;
+
     // Normally the sweep timer is automatically deduced based on the node
     // size, but we allow admins to explicitly set it in the config.
     std::optional<int> SWEEP_INTERVAL;
@@ -269,6 +285,10 @@ public:
     // Percentage of peers with the tx reduce-relay feature enabled
     // to relay to out of total active peers
     std::size_t TX_RELAY_PERCENTAGE = 25;
+    // How long transactions relayed to a peer with the tx reduce-relay
+    // feature enabled are aggregated before they are sent in one
+    // TMTransactions message. Zero sends each transaction at once.
+    std::chrono::milliseconds TX_BATCH_WINDOW{0};
 
     // These override the command line client settings
     std::optional<beast::IP::Endpoint> rpc_ip;
@@ -50,6 +50,7 @@ struct ConfigSection
 #define SECTION_DEBUG_LOGFILE "debug_logfile"
 #define SECTION_ELB_SUPPORT "elb_support"
 #define SECTION_FEE_DEFAULT "fee_default"
+#define SECTION_FETCH_BATCH "fetch_batch"
 #define SECTION_FETCH_DEPTH "fetch_depth"
 #define SECTION_INSIGHT "insight"
 #define SECTION_IO_WORKERS "io_workers"
@@ -57,12 +58,15 @@ struct ConfigSection
 #define SECTION_IPS_FIXED "ips_fixed"
 #define SECTION_LEDGER_HISTORY "ledger_history"
 #define SECTION_LEDGER_REPLAY "ledger_replay"
+#define SECTION_LEDGER_SNAPSHOTS "ledger_snapshots"
 #define SECTION_MAX_TRANSACTIONS "max_transactions"
 #define SECTION_NETWORK_ID "network_id"
 #define SECTION_NETWORK_QUORUM "network_quorum"
 #define SECTION_NODE_SEED "node_seed"
 #define SECTION_NODE_SIZE "node_size"
 #define SECTION_OVERLAY "overlay"
+#define SECTION_PARALLEL_HASHING "parallel_hashing"
+#define SECTION_PARALLEL_INVARIANTS "parallel_invariants"
 #define SECTION_PATH_SEARCH_OLD "path_search_old"
 #define SECTION_PATH_SEARCH "path_search"
 #define SECTION_PATH_SEARCH_FAST "path_search_fast"
@@ -0,0 +1,301 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#ifndef RIPPLE_CORE_COROTASK_H_INCLUDED
+#define RIPPLE_CORE_COROTASK_H_INCLUDED
+
+#include <xrpld/core/JobQueue.h>
+
+#include <xrpl/basics/LocalValue.h>
+#include <xrpl/basics/Log.h>
+#include <xrpl/beast/utility/instrumentation.h>
+
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace ripple {
+
+/** A stackless coroutine which runs on the JobQueue.
+
+    A function returning CoroTask is a coroutine. Calling it creates the
+    coroutine without running any of it, and passing the result to
+    JobQueue::postCoroTask adds a job which runs it. A coroutine waits for
+    an event without holding a thread by awaiting CoroTask::suspend:
+
+        co_await CoroTask::suspend([&](CoroTask::Resume resume) {
+            // Arrange for resume() to be called when the event occurs
+        });
+
+    Calling the Resume adds a job which continues the coroutine after the
+    co_await. A suspended coroutine holds only its frame, which is the size
+    of its local variables, rather than the stack a JobQueue::Coro needs.
+    The coroutine is only ever suspended when the Resume can be called, so
+    no lock is needed to guard against the event occurring before the
+    coroutine suspends.
+
+    Like JobQueue::Coro, each coroutine has its own LocalValue instances.
+    An exception which escapes a coroutine destroys it and is logged.
+
+    @note Coroutine parameters are copied into the frame, but the objects
+          that reference parameters and lambda captures refer to are not.
+*/
+class CoroTask
+{
+public:
+    struct promise_type;
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    struct promise_type
+    {
+        JobQueue* jq = nullptr;
+        JobType type = jtINVALID;
+        std::string name;
+        detail::LocalValues lvs;
+
+        CoroTask
+        get_return_object()
+        {
+            return CoroTask{handle_type::from_promise(*this)};
+        }
+
+        std::suspend_always
+        initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        // The frame is destroyed as soon as the coroutine returns
+        std::suspend_never
+        final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void
+        return_void()
+        {
+        }
+
+        // An exception which escapes the coroutine ends it. There is no
+        // caller to take it, and one thrown out of a job ends the process,
+        // so log it.
+        void
+        unhandled_exception() noexcept
+        {
+            try
+            {
+                throw;
+            }
+            catch (std::exception const& e)
+            {
+                JLOG(jq->m_journal.error())
+                    << "CoroTask " << name << " threw: " << e.what();
+            }
+            catch (...)
+            {
+                JLOG(jq->m_journal.error())
+                    << "CoroTask " << name << " threw an unknown exception";
+            }
+        }
+    };
+
+    /** Continues a suspended coroutine.
+
+        Copies refer to the same coroutine, and it must be continued only
+        once. If every copy is destroyed without the coroutine being
+        continued, the coroutine is destroyed, along with its local
+        variables.
+    */
+    class Resume
+    {
+    public:
+        /** Add a job which continues the coroutine.
+
+            @return true if the job was added. If not, the JobQueue is
+                    stopping, and the coroutine is destroyed.
+        */
+        bool
+        operator()() const;
+
+    private:
+        friend class CoroTask;
+
+        struct State
+        {
+            handle_type handle;
+
+            explicit State(handle_type h) : handle(h)
+            {
+            }
+
+            State(State const&) = delete;
+            State&
+            operator=(State const&) = delete;
+
+            ~State();
+        };
+
+        explicit Resume(handle_type h) : state_(std::make_shared<State>(h))
+        {
+        }
+
+        std::shared_ptr<State> state_;
+    };
+
+    template <class F>
+    class Suspend
+    {
+    public:
+        explicit Suspend(F f) : f_(std::move(f))
+        {
+        }
+
+        bool
+        await_ready() const noexcept
+        {
+            return false;
+        }
+
+        void
+        await_suspend(handle_type h) noexcept
+        {
+            ++h.promise().jq->nSuspend_;
+
+            // The coroutine, and this awaiter with it, may be destroyed as
+            // soon as the Resume is called, so call a copy of the function.
+            auto f = std::move(f_);
+            f(Resume{h});
+        }
+
+        void
+        await_resume() const noexcept
+        {
+        }
+
+    private:
+        F f_;
+    };
+
+    /** Suspend the coroutine, and call a function with the Resume which
+        continues it.
+
+        The function is called once the coroutine is suspended, on the same
+        thread. It must not throw, and it must not use the local variables
+        of the coroutine once it has arranged for the Resume to be called.
+    */
+    template <class F>
+    static Suspend<std::decay_t<F>>
+    suspend(F&& f)
+    {
+        return Suspend<std::decay_t<F>>{std::forward<F>(f)};
+    }
+
+    CoroTask(CoroTask&& other) noexcept
+        : handle_(std::exchange(other.handle_, nullptr))
+    {
+    }
+
+    CoroTask&
+    operator=(CoroTask&&) = delete;
+
+    /** Destroys the coroutine if it was never posted. */
+    ~CoroTask()
+    {
+        if (handle_)
+            handle_.destroy();
+    }
+
+private:
+    friend class JobQueue;
+
+    explicit CoroTask(handle_type h) : handle_(h)
+    {
+    }
+
+    // Installs the LocalValue instances of a coroutine on this thread, and
+    // restores those of the thread however the coroutine leaves
+    class LocalValuesGuard
+    {
+    public:
+        explicit LocalValuesGuard(detail::LocalValues& lvs)
+            : saved_(detail::getLocalValues().release())
+        {
+            detail::getLocalValues().reset(&lvs);
+        }
+
+        LocalValuesGuard(LocalValuesGuard const&) = delete;
+        LocalValuesGuard&
+        operator=(LocalValuesGuard const&) = delete;
+
+        ~LocalValuesGuard()
+        {
+            // The coroutine owns the instances, which may already be gone
+            detail::getLocalValues().release();
+            detail::getLocalValues().reset(saved_);
+        }
+
+    private:
+        detail::LocalValues* saved_;
+    };
+
+    // Runs the coroutine until it next suspends or returns, with its own
+    // LocalValue instances
+    static void
+    run(handle_type h)
+    {
+        LocalValuesGuard guard(h.promise().lvs);
+        // This may destroy the frame, and the LocalValues with it
+        h.resume();
+    }
+
+    handle_type handle_;
+};
+
+inline bool
+CoroTask::Resume::operator()() const
+{
+    auto const h = std::exchange(state_->handle, nullptr);
+    XRPL_ASSERT(h, "ripple::CoroTask::Resume::operator() : not resumed");
+
+    auto& promise = h.promise();
+    --promise.jq->nSuspend_;
+    if (promise.jq->addJob(promise.type, promise.name, [h]() { run(h); }))
+        return true;
+
+    // The coroutine will not run
+    h.destroy();
+    return false;
+}
+
+inline CoroTask::Resume::State::~State()
+{
+    if (handle)
+    {
+        --handle.promise().jq->nSuspend_;
+        handle.destroy();
+    }
+}
+
+}  // namespace ripple
+
+#endif
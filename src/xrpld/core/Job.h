@@ -71,6 +71,9 @@ enum JobType {
     jtVALIDATION_t,       // A validation from a trusted source
     jtWRITE,              // Write out hashed objects
     jtACCEPT,             // Accept a consensus ledger
+    jtINVARIANT,          // Help to check the invariants of a transaction
+    jtLEDGER_HASH,        // Help to hash and write the nodes of a ledger
+    jtNODE_FETCH,         // Help to read a batch of nodes of a ledger
     jtPROPOSAL_t,         // A proposal from a trusted source
     jtNETOP_CLUSTER,      // NetworkOPs cluster peer report
     jtNETOP_TIMER,        // NetworkOPs net timer processing
@@ -30,7 +30,8 @@
 
 #include <boost/coroutine/all.hpp>
 
-#include <set>
+#include <atomic>
+#include <functional>
 
 namespace ripple {
 
@@ -38,6 +39,7 @@ namespace perf {
 class PerfLog;
 }
 
+class CoroTask;
 class Logs;
 struct Coro_create_t
 {
@@ -188,6 +190,45 @@ public:
     std::shared_ptr<Coro>
     postCoro(JobType t, std::string const& name, F&& f);
 
+    /** Adds a job to the queue which will run a stackless coroutine.
+
+        @param t The type of job, used each time the coroutine continues.
+        @param name Name of the job.
+        @param task The coroutine, which has not started.
+
+        @return true if the job was added. If not, the coroutine is
+                destroyed without running.
+
+        @see CoroTask
+    */
+    bool
+    postCoroTask(JobType t, std::string const& name, CoroTask task);
+
+    /** Calls a function for every index in [0, count), in parallel.
+
+        The calls are made on the calling thread, helped by up to the given
+        number of jobs. The calling thread never waits for a job to start, so
+        this makes progress even if every thread of the queue is busy, and may
+        be used from within a job. Jobs which start after every call has
+        started do nothing.
+
+        @param type The type of the helping jobs.
+        @param name Name of the helping jobs.
+        @param workers The maximum number of helping jobs.
+        @param count The number of calls.
+        @param f Has a signature of void(std::size_t).
+
+        If any call throws, the exception of the call with the lowest index
+        is rethrown once all calls have returned.
+    */
+    void
+    runParallel(
+        JobType type,
+        std::string const& name,
+        int workers,
+        std::size_t count,
+        std::function<void(std::size_t)> f);
+
     /** Jobs waiting at this priority.
      */
     int
@@ -241,24 +282,29 @@ public:
 
 private:
     friend class Coro;
+    friend class CoroTask;
 
     using JobDataMap = std::map<JobType, JobTypeData>;
 
     beast::Journal m_journal;
+    // Held to wait for and notify cv_. Each job type has a lock of its own
+    // for its jobs.
     mutable std::mutex m_mutex;
-    std::uint64_t m_lastJob;
-    std::set<Job> m_jobSet;
+    std::atomic<std::uint64_t> m_lastJob;
     JobCounter jobCounter_;
     std::atomic_bool stopping_{false};
     std::atomic_bool stopped_{false};
     JobDataMap m_jobData;
     JobTypeData m_invalidJobData;
 
+    // The number of jobs waiting, of every type
+    std::atomic<int> m_queued{0};
+
     // The number of jobs currently in processTask()
-    int m_processCount;
+    std::atomic<int> m_processCount;
 
     // The number of suspended coroutines
-    int nSuspend_ = 0;
+    std::atomic<int> nSuspend_ = 0;
 
     Workers m_workers;
 
@@ -270,6 +316,15 @@ private:
 
     std::condition_variable cv_;
 
+    // Counts the jobs added and finished, either of which can make a job
+    // runnable, so a worker which found none can wait for the next one.
+    std::atomic<std::uint64_t> jobEvents_{0};
+
+    // The number of workers waiting on jobCv_ for a runnable job
+    std::atomic<int> jobWaiters_{0};
+
+    std::condition_variable jobCv_;
+
     void
     collect();
     JobTypeData&
@@ -292,27 +347,44 @@ private:
     // Returns the next Job we should run now.
     //
     // RunnableJob:
-    //  A Job in the JobSet whose slots count for its type is greater than zero.
+    //  A waiting Job whose slots count for its type is greater than zero.
+    //
+    // The types are searched from the highest priority to the lowest, and
+    // the jobs of each type are run in the order they were added, which is
+    // the order of the single job set this replaces. Only the lock of the
+    // type taken from is held, so workers taking jobs of different types,
+    // and jobs being added of other types, do not contend.
+    //
+    // A worker which finds no RunnableJob searches again a few times, then
+    // waits until a job is added or finished.
     //
     // Pre-conditions:
-    //  mJobSet must not be empty.
-    //  mJobSet holds at least one RunnableJob
+    //  A task was added for the calling worker, so a RunnableJob exists
+    //  or will, once the worker that took the job this worker would have
+    //  had finishes its search.
     //
     // Post-conditions:
     //  job is a valid Job object.
-    //  job is removed from mJobQueue.
+    //  job is removed from the jobs of its type.
     //  Waiting job count of its type is decremented
     //  Running job count of its type is incremented
-    //
-    // Invariants:
-    //  The calling thread owns the JobLock
     void
     getNextJob(Job& job);
 
+    // Takes the first job of a type if one is waiting and the type is below
+    // its limit. Returns false if not.
+    bool
+    takeJob(JobTypeData& data, Job& job);
+
+    // Wakes the workers waiting in getNextJob after a job was added or
+    // finished. Only takes the lock if some worker is waiting.
+    void
+    notifyJobEvent();
+
     // Indicates that a running Job has completed its task.
     //
     // Pre-conditions:
-    //  Job must not exist in mJobSet.
+    //  Job must no longer be waiting.
     //  The JobType must not be invalid.
     //
     // Post-conditions:
@@ -325,10 +397,14 @@ private:
     void
     finishJob(JobType type);
 
+    // Returns true if no job is waiting or running
+    bool
+    isIdle() const;
+
     // Runs the next appropriate waiting Job.
     //
     // Pre-conditions:
-    //  A RunnableJob must exist in the JobSet
+    //  A task was added for a RunnableJob
     //
     // Post-conditions:
     //  The chosen RunnableJob will have Job::doJob() called.
@@ -25,6 +25,10 @@
 #include <xrpl/basics/Log.h>
 #include <xrpl/beast/insight/Collector.h>
 
+#include <atomic>
+#include <deque>
+#include <mutex>
+
 namespace ripple {
 
 struct JobTypeData
@@ -39,8 +43,15 @@ public:
     /* The job category which we represent */
     JobTypeInfo const& info;
 
+    /* Guards the jobs and the counts, except that the number of jobs
+       waiting may be read without it */
+    mutable std::mutex mutex;
+
+    /* The jobs waiting, in the order they were added */
+    std::deque<Job> jobs;
+
     /* The number of jobs waiting */
-    int waiting;
+    std::atomic<int> waiting;
 
     /* The number presently running */
     int running;
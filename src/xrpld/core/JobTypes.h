@@ -101,6 +101,9 @@ private:
         add(jtVALIDATION_t,      "trustedValidation",    maxLimit,   500ms,  1500ms);
         add(jtWRITE,             "writeObjects",         maxLimit,  1750ms,  2500ms);
         add(jtACCEPT,            "acceptLedger",         maxLimit,     0ms,     0ms);
+        add(jtINVARIANT,         "checkInvariants",      maxLimit,     0ms,     0ms);
+        add(jtLEDGER_HASH,       "hashLedger",           maxLimit,     0ms,     0ms);
+        add(jtNODE_FETCH,        "fetchNodes",           maxLimit,     0ms,     0ms);
         add(jtPROPOSAL_t,        "trustedProposal",      maxLimit,   100ms,   500ms);
         add(jtSWEEP,             "sweep",                       1,     0ms,     0ms);
         add(jtNETOP_CLUSTER,     "clusterReport",               1,  9999ms,  9999ms);
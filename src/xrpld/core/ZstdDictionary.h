@@ -0,0 +1,154 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#ifndef RIPPLE_CORE_ZSTDDICTIONARY_H_INCLUDED
+#define RIPPLE_CORE_ZSTDDICTIONARY_H_INCLUDED
+
+#include <xrpl/basics/Blob.h>
+#include <xrpl/basics/Slice.h>
+
+#include <boost/filesystem/path.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
+namespace ripple {
+
+/** A zstd dictionary for compressing small objects.
+
+    Node objects and peer messages are small, and most of their bytes are
+    structure shared with others of their kind: field headers, common
+    account IDs, and so on. A general purpose compressor like LZ4 can't find
+    that structure within a single small object, but zstd can, given a
+    dictionary trained on many of them.
+
+    Each dictionary has an ID. The node store keeps the ID with every object
+    it compresses, and may hold objects compressed with any dictionary it
+    has ever used, so it registers every dictionary still in use before the
+    objects compressed with it are read. Registered dictionaries are never
+    released. The overlay negotiates dictionaries with each peer instead,
+    and does not register them.
+*/
+class ZstdDictionary
+{
+public:
+    /** Load a dictionary.
+
+        @param content The dictionary, as produced by train.
+        @param level The level to compress at.
+        @throws std::runtime_error if the content is not a dictionary, or it
+                has no ID.
+    */
+    explicit ZstdDictionary(Blob content, int level = defaultLevel);
+
+    ~ZstdDictionary();
+
+    ZstdDictionary(ZstdDictionary const&) = delete;
+    ZstdDictionary&
+    operator=(ZstdDictionary const&) = delete;
+
+    /** Load a dictionary from a file. */
+    static std::shared_ptr<ZstdDictionary const>
+    load(boost::filesystem::path const& path, int level = defaultLevel);
+
+    /** Train a dictionary on sample objects.
+
+        @param samples The objects to train on.
+        @param capacity The maximum size of the dictionary, in bytes.
+        @param id The ID of the dictionary, which must not be zero. Use a
+                  new ID for each dictionary trained for the same store.
+        @return The content of the dictionary.
+        @throws std::runtime_error if training fails, typically because
+                there are too few samples.
+    */
+    static Blob
+    train(
+        std::vector<Blob> const& samples,
+        std::size_t capacity,
+        std::uint32_t id,
+        int level = defaultLevel);
+
+    /** Register a dictionary, so objects compressed with it can be read.
+
+        Registering the same dictionary twice has no effect.
+
+        @return The registered dictionary with the same ID.
+        @throws std::runtime_error if a different dictionary with the same ID
+                is already registered.
+    */
+    static ZstdDictionary const&
+    add(std::shared_ptr<ZstdDictionary const> dictionary);
+
+    /** Return the registered dictionary with an ID, or nullptr. */
+    static ZstdDictionary const*
+    find(std::uint32_t id);
+
+    std::uint32_t
+    id() const
+    {
+        return id_;
+    }
+
+    Slice
+    content() const
+    {
+        return makeSlice(content_);
+    }
+
+    /** Return the most bytes compress can write for the given input. */
+    static std::size_t
+    compressBound(std::size_t size);
+
+    /** Compress with this dictionary.
+
+        @return The number of bytes written to out.
+        @throws std::runtime_error if compression fails.
+    */
+    std::size_t
+    compress(void const* in, std::size_t inSize, void* out, std::size_t outMax)
+        const;
+
+    /** Decompress data compressed with this dictionary.
+
+        @return The number of bytes written to out.
+        @throws std::runtime_error if the data is not valid, or does not fit.
+    */
+    std::size_t
+    decompress(
+        void const* in,
+        std::size_t inSize,
+        void* out,
+        std::size_t outMax) const;
+
+    static constexpr int defaultLevel = 3;
+
+private:
+    Blob const content_;
+    std::uint32_t id_;
+    ZSTD_CDict_s* cdict_ = nullptr;
+    ZSTD_DDict_s* ddict_ = nullptr;
+};
+
+}  // namespace ripple
+
+#endif
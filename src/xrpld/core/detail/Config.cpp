@@ -729,6 +729,46 @@ Config::loadFromString(std::string const& fileContents)
                 ": must be between 1 and 1024 inclusive.");
     }
 
+    if (exists(SECTION_FETCH_BATCH))
+    {
+        auto const sec = section(SECTION_FETCH_BATCH);
+
+        FETCH_BATCH_SIZE = sec.value_or("size", FETCH_BATCH_SIZE);
+        FETCH_BATCHES_IN_FLIGHT =
+            sec.value_or("in_flight", FETCH_BATCHES_IN_FLIGHT);
+        if (FETCH_BATCH_SIZE < 1 || FETCH_BATCH_SIZE > 65536)
+            Throw<std::runtime_error>(
+                "Invalid " SECTION_FETCH_BATCH
+                ", size must be between 1 and 65536 inclusive.");
+        if (FETCH_BATCHES_IN_FLIGHT < 1 || FETCH_BATCHES_IN_FLIGHT > 64)
+            Throw<std::runtime_error>(
+                "Invalid " SECTION_FETCH_BATCH
+                ", in_flight must be between 1 and 64 inclusive.");
+    }
+
+    if (exists(SECTION_PARALLEL_HASHING))
+    {
+        PARALLEL_HASH_WORKERS =
+            section(SECTION_PARALLEL_HASHING).value_or("workers", 0);
+        if (PARALLEL_HASH_WORKERS < 0 || PARALLEL_HASH_WORKERS > 64)
+            Throw<std::runtime_error>(
+                "Invalid " SECTION_PARALLEL_HASHING
+                ", workers must be between 0 and 64 inclusive.");
+    }
+
+    if (exists(SECTION_PARALLEL_INVARIANTS))
+    {
+        auto const sec = section(SECTION_PARALLEL_INVARIANTS);
+
+        PARALLEL_INVARIANT_WORKERS = sec.value_or("workers", 0);
+        PARALLEL_INVARIANT_MIN_ENTRIES = sec.value_or(
+            "min_entries", PARALLEL_INVARIANT_MIN_ENTRIES);
+        if (PARALLEL_INVARIANT_WORKERS < 0 || PARALLEL_INVARIANT_WORKERS > 64)
+            Throw<std::runtime_error>(
+                "Invalid " SECTION_PARALLEL_INVARIANTS
+                ", workers must be between 0 and 64 inclusive.");
+    }
+
     if (getSingleSection(secConfig, SECTION_COMPRESSION, strTemp, j_))
         COMPRESSION = beast::lexicalCastThrow<bool>(strTemp);
 
@@ -787,6 +827,15 @@ Config::loadFromString(std::string const& fileContents)
                 ", tx_min_peers must be greater than or equal to 10"
                 ", tx_relay_percentage must be greater than or equal to 10 "
                 "and less than or equal to 100");
+
+        TX_BATCH_WINDOW =
+            std::chrono::milliseconds{sec.value_or("tx_batch_window", 0)};
+        if (TX_BATCH_WINDOW < std::chrono::milliseconds{0} ||
+            TX_BATCH_WINDOW > std::chrono::milliseconds{100})
+            Throw<std::runtime_error>(
+                "Invalid " SECTION_REDUCE_RELAY
+                ", tx_batch_window must be between 0 and 100 milliseconds, "
+                "inclusive");
     }
 
     if (getSingleSection(secConfig, SECTION_MAX_TRANSACTIONS, strTemp, j_))
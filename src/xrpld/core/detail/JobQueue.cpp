@@ -17,15 +17,81 @@
 */
 //==============================================================================
 
+#include <xrpld/core/CoroTask.h>
 #include <xrpld/core/JobQueue.h>
 #include <xrpld/perflog/PerfLog.h>
 
 #include <xrpl/basics/contract.h>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
 #include <mutex>
+#include <vector>
 
 namespace ripple {
 
+namespace {
+
+// The calls of runParallel, shared by the calling thread and the jobs helping
+// it
+class ParallelCalls
+{
+    std::function<void(std::size_t)> const f_;
+    std::size_t const count_;
+    std::atomic<std::size_t> next_ = 0;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::size_t done_ = 0;
+    std::vector<std::exception_ptr> errors_;
+
+public:
+    ParallelCalls(std::function<void(std::size_t)> f, std::size_t count)
+        : f_(std::move(f)), count_(count), errors_(count)
+    {
+    }
+
+    // Makes calls until none are left to start
+    void
+    work()
+    {
+        for (auto i = next_++; i < count_; i = next_++)
+        {
+            std::exception_ptr error;
+            try
+            {
+                f_(i);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+
+            std::lock_guard lock(mutex_);
+            errors_[i] = std::move(error);
+            if (++done_ == count_)
+                cv_.notify_all();
+        }
+    }
+
+    void
+    wait()
+    {
+        std::unique_lock lock(mutex_);
+        cv_.wait(lock, [this] { return done_ == count_; });
+
+        for (auto const& e : errors_)
+        {
+            if (e)
+                std::rethrow_exception(e);
+        }
+    }
+};
+
+}  // namespace
+
 JobQueue::JobQueue(
     int threadCount,
     beast::insight::Collector::ptr const& collector,
@@ -74,8 +140,7 @@ JobQueue::~JobQueue()
 void
 JobQueue::collect()
 {
-    std::lock_guard lock(m_mutex);
-    job_count = m_jobSet.size();
+    job_count = m_queued.load();
 }
 
 bool
@@ -107,26 +172,15 @@ JobQueue::addRefCountedJob(
         "ripple::JobQueue::addRefCountedJob : threads available or job "
         "requires no threads");
 
+    bool task = false;
     {
-        std::lock_guard lock(m_mutex);
-        auto result =
-            m_jobSet.emplace(type, name, ++m_lastJob, data.load(), func);
-        auto const& job = *result.first;
-
-        JobType const type(job.getType());
-        XRPL_ASSERT(
-            type != jtINVALID,
-            "ripple::JobQueue::addRefCountedJob : has valid job type");
-        XRPL_ASSERT(
-            m_jobSet.find(job) != m_jobSet.end(),
-            "ripple::JobQueue::addRefCountedJob : job found");
-        perfLog_.jobQueue(type);
-
-        JobTypeData& data(getJobTypeData(type));
+        std::lock_guard lock(data.mutex);
+        data.jobs.emplace_back(type, name, ++m_lastJob, data.load(), func);
+        ++m_queued;
 
         if (data.waiting + data.running < getJobLimit(type))
         {
-            m_workers.addTask();
+            task = true;
         }
         else
         {
@@ -135,27 +189,76 @@ JobQueue::addRefCountedJob(
         }
         ++data.waiting;
     }
+
+    perfLog_.jobQueue(type);
+    notifyJobEvent();
+
+    // The worker woken by the task may need the lock
+    if (task)
+        m_workers.addTask();
+    return true;
+}
+
+void
+JobQueue::runParallel(
+    JobType type,
+    std::string const& name,
+    int workers,
+    std::size_t count,
+    std::function<void(std::size_t)> f)
+{
+    if (count == 0)
+        return;
+
+    auto const calls = std::make_shared<ParallelCalls>(std::move(f), count);
+
+    // The calling thread makes one of the calls itself
+    auto const jobs = std::min<std::size_t>(std::max(workers, 0), count - 1);
+    for (std::size_t i = 0; i < jobs; ++i)
+    {
+        if (!addJob(type, name, [calls]() { calls->work(); }))
+            break;
+    }
+
+    calls->work();
+    calls->wait();
+}
+
+bool
+JobQueue::postCoroTask(JobType t, std::string const& name, CoroTask task)
+{
+    auto const h = task.handle_;
+    auto& promise = h.promise();
+    promise.jq = this;
+    promise.type = t;
+    promise.name = name;
+
+    // If the job is not added, the task destroys the coroutine
+    if (!addJob(t, name, [h]() { CoroTask::run(h); }))
+        return false;
+
+    task.handle_ = nullptr;
     return true;
 }
 
 int
 JobQueue::getJobCount(JobType t) const
 {
-    std::lock_guard lock(m_mutex);
-
     JobDataMap::const_iterator c = m_jobData.find(t);
 
-    return (c == m_jobData.end()) ? 0 : c->second.waiting;
+    return (c == m_jobData.end()) ? 0 : c->second.waiting.load();
 }
 
 int
 JobQueue::getJobCountTotal(JobType t) const
 {
-    std::lock_guard lock(m_mutex);
-
     JobDataMap::const_iterator c = m_jobData.find(t);
+    if (c == m_jobData.end())
+        return 0;
 
-    return (c == m_jobData.end()) ? 0 : (c->second.waiting + c->second.running);
+    auto const& data = c->second;
+    std::lock_guard lock(data.mutex);
+    return data.waiting + data.running;
 }
 
 int
@@ -164,8 +267,6 @@ JobQueue::getJobCountGE(JobType t) const
     // return the number of jobs at this priority level or greater
     int ret = 0;
 
-    std::lock_guard lock(m_mutex);
-
     for (auto const& x : m_jobData)
     {
         if (x.first >= t)
@@ -220,8 +321,6 @@ JobQueue::getJson(int c)
 
     Json::Value priorities = Json::arrayValue;
 
-    std::lock_guard lock(m_mutex);
-
     for (auto& x : m_jobData)
     {
         XRPL_ASSERT(
@@ -234,8 +333,13 @@ JobQueue::getJson(int c)
 
         LoadMonitor::Stats stats(data.stats());
 
-        int waiting(data.waiting);
-        int running(data.running);
+        int waiting;
+        int running;
+        {
+            std::lock_guard lock(data.mutex);
+            waiting = data.waiting;
+            running = data.running;
+        }
 
         if ((stats.count != 0) || (waiting != 0) ||
             (stats.latencyPeak != 0ms) || (running != 0))
@@ -273,7 +377,16 @@ void
 JobQueue::rendezvous()
 {
     std::unique_lock<std::mutex> lock(m_mutex);
-    cv_.wait(lock, [this] { return m_processCount == 0 && m_jobSet.empty(); });
+    cv_.wait(lock, [this] { return isIdle(); });
+}
+
+bool
+JobQueue::isIdle() const
+{
+    // A job is counted as being processed before it stops waiting, so
+    // reading in this order never misses a job which is moving between the
+    // two.
+    return m_queued == 0 && m_processCount == 0;
 }
 
 JobTypeData&
@@ -305,13 +418,12 @@ JobQueue::stop()
         // `Job::doJob` and the return of `JobQueue::processTask`. That is why
         // we must wait on the condition variable to make these assertions.
         std::unique_lock<std::mutex> lock(m_mutex);
-        cv_.wait(
-            lock, [this] { return m_processCount == 0 && m_jobSet.empty(); });
+        cv_.wait(lock, [this] { return isIdle(); });
         XRPL_ASSERT(
             m_processCount == 0,
             "ripple::JobQueue::stop : all processes completed");
         XRPL_ASSERT(
-            m_jobSet.empty(), "ripple::JobQueue::stop : all jobs completed");
+            m_queued == 0, "ripple::JobQueue::stop : all jobs completed");
         XRPL_ASSERT(
             nSuspend_ == 0, "ripple::JobQueue::stop : no coros suspended");
         stopped_ = true;
@@ -327,38 +439,74 @@ JobQueue::isStopped() const
 void
 JobQueue::getNextJob(Job& job)
 {
-    XRPL_ASSERT(
-        !m_jobSet.empty(), "ripple::JobQueue::getNextJob : non-empty jobs");
+    // Searches made before waiting. The job left for this worker is usually
+    // made runnable within a few, and waiting costs a lock and a wake-up.
+    constexpr int searches = 4;
 
-    std::set<Job>::const_iterator iter;
-    for (iter = m_jobSet.begin(); iter != m_jobSet.end(); ++iter)
+    for (int i = 0;; ++i)
     {
-        JobType const type = iter->getType();
-        XRPL_ASSERT(
-            type != jtINVALID, "ripple::JobQueue::getNextJob : valid job type");
-
-        JobTypeData& data(getJobTypeData(type));
-        XRPL_ASSERT(
-            data.running <= getJobLimit(type),
-            "ripple::JobQueue::getNextJob : maximum jobs running");
+        // Read before searching, so a job added or finished during the
+        // search ends the wait below at once.
+        auto const events = jobEvents_.load();
 
-        // Run this job if we're running below the limit.
-        if (data.running < getJobLimit(data.type()))
+        // Highest priority first
+        for (auto iter = m_jobData.rbegin(); iter != m_jobData.rend(); ++iter)
         {
-            XRPL_ASSERT(
-                data.waiting > 0,
-                "ripple::JobQueue::getNextJob : positive data waiting");
-            --data.waiting;
-            ++data.running;
-            break;
+            if (takeJob(iter->second, job))
+                return;
         }
+
+        // Another worker took the job this one would have had, and the job
+        // which that worker leaves for this one was added to a type which
+        // was already searched, or is about to become runnable.
+        if (i < searches)
+            continue;
+
+        std::unique_lock lock(m_mutex);
+        ++jobWaiters_;
+        jobCv_.wait(lock, [&] { return jobEvents_.load() != events; });
+        --jobWaiters_;
     }
+}
 
+void
+JobQueue::notifyJobEvent()
+{
+    // The count is raised before the waiters are read, and a worker counts
+    // itself waiting before it reads the count, so one of the two always
+    // sees the other.
+    ++jobEvents_;
+    if (jobWaiters_.load() == 0)
+        return;
+
+    std::lock_guard lock(m_mutex);
+    jobCv_.notify_all();
+}
+
+bool
+JobQueue::takeJob(JobTypeData& data, Job& job)
+{
+    // Most types have nothing waiting, so don't take their locks
+    if (data.waiting == 0)
+        return false;
+
+    std::lock_guard lock(data.mutex);
     XRPL_ASSERT(
-        iter != m_jobSet.end(),
-        "ripple::JobQueue::getNextJob : found next job");
-    job = *iter;
-    m_jobSet.erase(iter);
+        data.running <= getJobLimit(data.type()),
+        "ripple::JobQueue::takeJob : maximum jobs running");
+
+    // Run this job if we're running below the limit.
+    if (data.jobs.empty() || data.running >= getJobLimit(data.type()))
+        return false;
+
+    XRPL_ASSERT(
+        data.waiting > 0, "ripple::JobQueue::takeJob : positive data waiting");
+    job = std::move(data.jobs.front());
+    data.jobs.pop_front();
+    --data.waiting;
+    ++data.running;
+    --m_queued;
+    return true;
 }
 
 void
@@ -370,18 +518,27 @@ JobQueue::finishJob(JobType type)
 
     JobTypeData& data = getJobTypeData(type);
 
-    // Queue a deferred task if possible
-    if (data.deferred > 0)
+    bool task = false;
     {
-        XRPL_ASSERT(
-            data.running + data.waiting >= getJobLimit(type),
-            "ripple::JobQueue::finishJob : job limit");
+        std::lock_guard lock(data.mutex);
 
-        --data.deferred;
-        m_workers.addTask();
+        // Queue a deferred task if possible
+        if (data.deferred > 0)
+        {
+            XRPL_ASSERT(
+                data.running + data.waiting >= getJobLimit(type),
+                "ripple::JobQueue::finishJob : job limit");
+
+            --data.deferred;
+            task = true;
+        }
+
+        --data.running;
     }
 
-    --data.running;
+    notifyJobEvent();
+    if (task)
+        m_workers.addTask();
 }
 
 void
@@ -394,11 +551,8 @@ JobQueue::processTask(int instance)
         Job::clock_type::time_point const start_time(Job::clock_type::now());
         {
             Job job;
-            {
-                std::lock_guard lock(m_mutex);
-                getNextJob(job);
-                ++m_processCount;
-            }
+            ++m_processCount;
+            getNextJob(job);
             type = job.getType();
             JobTypeData& data(getJobTypeData(type));
             JLOG(m_journal.trace()) << "Doing " << data.name() << "job";
@@ -423,14 +577,16 @@ JobQueue::processTask(int instance)
         }
     }
 
+    // Job should be destroyed before stopping
+    // otherwise destructors with side effects can access
+    // parent objects that are already destroyed.
+    finishJob(type);
+    if (--m_processCount == 0 && m_queued == 0)
     {
+        // Taking the lock ensures a thread which found the queue busy is
+        // waiting before it is notified
         std::lock_guard lock(m_mutex);
-        // Job should be destroyed before stopping
-        // otherwise destructors with side effects can access
-        // parent objects that are already destroyed.
-        finishJob(type);
-        if (--m_processCount == 0 && m_jobSet.empty())
-            cv_.notify_all();
+        cv_.notify_all();
     }
 
     // Note that when Job::~Job is called, the last reference
@@ -0,0 +1,241 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <xrpld/core/ZstdDictionary.h>
+
+#include <xrpl/basics/FileUtilities.h>
+#include <xrpl/basics/contract.h>
+
+#define ZDICT_STATIC_LINKING_ONLY
+#include <zdict.h>
+#include <zstd.h>
+
+#include <map>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <string>
+
+namespace ripple {
+
+namespace {
+
+struct ContextDeleter
+{
+    void
+    operator()(ZSTD_CCtx* ctx) const
+    {
+        ZSTD_freeCCtx(ctx);
+    }
+
+    void
+    operator()(ZSTD_DCtx* ctx) const
+    {
+        ZSTD_freeDCtx(ctx);
+    }
+};
+
+// Contexts hold large buffers which are costly to set up, so each thread
+// keeps one of each for all of its calls.
+ZSTD_CCtx*
+compressionContext()
+{
+    thread_local std::unique_ptr<ZSTD_CCtx, ContextDeleter> const ctx = [] {
+        std::unique_ptr<ZSTD_CCtx, ContextDeleter> ctx{ZSTD_createCCtx()};
+        if (!ctx)
+            Throw<std::bad_alloc>();
+        // Node store blobs and message headers both record the size of the
+        // object and which dictionary compressed it, and the objects are
+        // hashed or checked by their parser, so the frame needn't store
+        // them again.
+        ZSTD_CCtx_setParameter(ctx.get(), ZSTD_c_contentSizeFlag, 0);
+        ZSTD_CCtx_setParameter(ctx.get(), ZSTD_c_checksumFlag, 0);
+        ZSTD_CCtx_setParameter(ctx.get(), ZSTD_c_dictIDFlag, 0);
+        return ctx;
+    }();
+    return ctx.get();
+}
+
+ZSTD_DCtx*
+decompressionContext()
+{
+    thread_local std::unique_ptr<ZSTD_DCtx, ContextDeleter> const ctx = [] {
+        std::unique_ptr<ZSTD_DCtx, ContextDeleter> ctx{ZSTD_createDCtx()};
+        if (!ctx)
+            Throw<std::bad_alloc>();
+        return ctx;
+    }();
+    return ctx.get();
+}
+
+struct Registry
+{
+    std::shared_mutex mutex;
+    std::map<std::uint32_t, std::shared_ptr<ZstdDictionary const>> map;
+};
+
+Registry&
+registry()
+{
+    static Registry r;
+    return r;
+}
+
+}  // namespace
+
+ZstdDictionary::ZstdDictionary(Blob content, int level)
+    : content_(std::move(content))
+    , id_(ZSTD_getDictID_fromDict(content_.data(), content_.size()))
+{
+    if (id_ == 0)
+        Throw<std::runtime_error>("zstd dictionary: missing ID");
+
+    cdict_ = ZSTD_createCDict(content_.data(), content_.size(), level);
+    ddict_ = ZSTD_createDDict(content_.data(), content_.size());
+    if (!cdict_ || !ddict_)
+    {
+        ZSTD_freeCDict(cdict_);
+        ZSTD_freeDDict(ddict_);
+        Throw<std::runtime_error>(
+            "zstd dictionary: can't load " + std::to_string(id_));
+    }
+}
+
+ZstdDictionary::~ZstdDictionary()
+{
+    ZSTD_freeCDict(cdict_);
+    ZSTD_freeDDict(ddict_);
+}
+
+std::shared_ptr<ZstdDictionary const>
+ZstdDictionary::load(boost::filesystem::path const& path, int level)
+{
+    boost::system::error_code ec;
+    auto const content = getFileContents(ec, path);
+    if (ec)
+        Throw<std::runtime_error>(
+            "zstd dictionary: can't read " + path.string() + ": " +
+            ec.message());
+    return std::make_shared<ZstdDictionary const>(
+        Blob(content.begin(), content.end()), level);
+}
+
+Blob
+ZstdDictionary::train(
+    std::vector<Blob> const& samples,
+    std::size_t capacity,
+    std::uint32_t id,
+    int level)
+{
+    if (id == 0)
+        Throw<std::runtime_error>("zstd dictionary: ID must not be zero");
+
+    Blob buffer;
+    std::vector<std::size_t> sizes;
+    sizes.reserve(samples.size());
+    for (auto const& sample : samples)
+    {
+        buffer.insert(buffer.end(), sample.begin(), sample.end());
+        sizes.push_back(sample.size());
+    }
+
+    // The parameters ZDICT_trainFromBuffer uses, except for the ID
+    ZDICT_fastCover_params_t params{};
+    params.d = 8;
+    params.steps = 4;
+    params.zParams.compressionLevel = level;
+    params.zParams.dictID = id;
+
+    Blob content(capacity);
+    auto const size = ZDICT_optimizeTrainFromBuffer_fastCover(
+        content.data(),
+        content.size(),
+        buffer.data(),
+        sizes.data(),
+        static_cast<unsigned>(sizes.size()),
+        &params);
+    if (ZDICT_isError(size))
+        Throw<std::runtime_error>(
+            std::string("zstd dictionary: training failed: ") +
+            ZDICT_getErrorName(size));
+    content.resize(size);
+    return content;
+}
+
+ZstdDictionary const&
+ZstdDictionary::add(std::shared_ptr<ZstdDictionary const> dictionary)
+{
+    auto& r = registry();
+    std::lock_guard lock(r.mutex);
+    auto const [it, inserted] = r.map.emplace(dictionary->id(), dictionary);
+    if (!inserted && it->second->content_ != dictionary->content_)
+        Throw<std::runtime_error>(
+            "zstd dictionary: another dictionary has ID " +
+            std::to_string(dictionary->id()));
+    return *it->second;
+}
+
+ZstdDictionary const*
+ZstdDictionary::find(std::uint32_t id)
+{
+    auto& r = registry();
+    std::shared_lock lock(r.mutex);
+    auto const it = r.map.find(id);
+    return it == r.map.end() ? nullptr : it->second.get();
+}
+
+std::size_t
+ZstdDictionary::compressBound(std::size_t size)
+{
+    return ZSTD_compressBound(size);
+}
+
+std::size_t
+ZstdDictionary::compress(
+    void const* in,
+    std::size_t inSize,
+    void* out,
+    std::size_t outMax) const
+{
+    auto const ctx = compressionContext();
+    auto result = ZSTD_CCtx_refCDict(ctx, cdict_);
+    if (!ZSTD_isError(result))
+        result = ZSTD_compress2(ctx, out, outMax, in, inSize);
+    if (ZSTD_isError(result))
+        Throw<std::runtime_error>(
+            std::string("zstd compress: ") + ZSTD_getErrorName(result));
+    return result;
+}
+
+std::size_t
+ZstdDictionary::decompress(
+    void const* in,
+    std::size_t inSize,
+    void* out,
+    std::size_t outMax) const
+{
+    auto const result = ZSTD_decompress_usingDDict(
+        decompressionContext(), out, outMax, in, inSize, ddict_);
+    if (ZSTD_isError(result))
+        Throw<std::runtime_error>(
+            std::string("zstd decompress: ") + ZSTD_getErrorName(result));
+    return result;
+}
+
+}  // namespace ripple
@@ -22,6 +22,8 @@
 
 #include <xrpld/nodestore/Types.h>
 
+#include <xrpl/basics/contract.h>
+
 #include <cstdint>
 
 namespace ripple {
@@ -137,6 +139,27 @@ public:
     virtual void
     for_each(std::function<void(std::shared_ptr<NodeObject>)> f) = 0;
 
+    /** Returns true if for_each_key can be called while the database is in
+        use.
+    */
+    virtual bool
+    canVisitKeysInUse() const
+    {
+        return false;
+    }
+
+    /** Visit the key of every object in the database.
+        Unlike for_each, this can be called while the database is in use. An
+        object stored during the visit may or may not be visited.
+        @param f Called with each key. Returning false stops the visit.
+        @see canVisitKeysInUse
+    */
+    virtual void
+    for_each_key(std::function<bool(uint256 const&)>)
+    {
+        LogicError("Backend::for_each_key : not supported");
+    }
+
     /** Estimate the number of write operations pending. */
     virtual int
     getWriteLoad() = 0;
@@ -144,6 +144,18 @@ public:
         FetchType fetchType = FetchType::synchronous,
         bool duplicate = false);
 
+    /** Fetch several node objects.
+        The default fetches each object in turn with fetchNodeObject. A
+        database may instead read all of them from its backend at once.
+
+        @note This can be called concurrently.
+        @param hashes The keys of the objects to retrieve.
+        @return The objects, in the order of their keys, with nullptr for any
+                that couldn't be retrieved.
+    */
+    virtual std::vector<std::shared_ptr<NodeObject>>
+    fetchBatch(std::vector<uint256> const& hashes);
+
     /** Fetch an object without waiting.
         If I/O is required to determine whether or not the object is present,
         `false` is returned. Otherwise, `true` is returned and `object` is set
@@ -200,7 +212,7 @@ public:
         return fetchSz_;
     }
 
-    void
+    virtual void
     getCountsJson(Json::Value& obj);
 
     /** Returns the number of file descriptors the database expects to need */
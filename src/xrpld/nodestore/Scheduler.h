@@ -22,6 +22,9 @@
 
 #include <xrpld/nodestore/Task.h>
 
+#include <xrpl/beast/insight/Collector.h>
+#include <xrpl/beast/insight/NullCollector.h>
+
 #include <chrono>
 
 namespace ripple {
@@ -82,6 +85,15 @@ public:
     */
     virtual void
     onBatchWrite(BatchWriteReport const& report) = 0;
+
+    /** Returns the collector for metrics of the backends.
+        By default the metrics are discarded.
+    */
+    virtual beast::insight::Collector::ptr
+    collector()
+    {
+        return beast::insight::NullCollector::New();
+    }
 };
 
 }  // namespace NodeStore
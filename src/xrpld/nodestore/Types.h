@@ -34,8 +34,8 @@ enum {
     batchWritePreallocationSize = 256,
 
     // This sets a limit on the maximum number of writes
-    // in a batch. Actual usage can be twice this since
-    // we have a new batch growing as we write the old.
+    // in a batch, and on the number of writes queued
+    // before callers have to wait.
     //
     batchWriteLimitSize = 65536
 };
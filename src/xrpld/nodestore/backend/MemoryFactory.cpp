@@ -199,6 +199,27 @@ public:
             f(e.second);
     }
 
+    bool
+    canVisitKeysInUse() const override
+    {
+        return true;
+    }
+
+    void
+    for_each_key(std::function<bool(uint256 const&)> f) override
+    {
+        XRPL_ASSERT(
+            db_,
+            "ripple::NodeStore::MemoryBackend::for_each_key : non-null "
+            "database");
+        std::lock_guard _(db_->mutex);
+        for (auto const& e : db_->table)
+        {
+            if (!f(e.first))
+                return;
+        }
+    }
+
     int
     getWriteLoad() override
     {
@@ -17,6 +17,7 @@
 */
 //==============================================================================
 
+#include <xrpld/core/ZstdDictionary.h>
 #include <xrpld/nodestore/Factory.h>
 #include <xrpld/nodestore/Manager.h>
 #include <xrpld/nodestore/detail/DecodedBlob.h>
@@ -54,6 +55,7 @@ public:
     std::size_t const burstSize_;
     std::string const name_;
     std::size_t const blockSize_;
+    ZstdDictionary const* const dictionary_;
     nudb::store db_;
     std::atomic<bool> deletePath_;
     Scheduler& scheduler_;
@@ -69,6 +71,7 @@ public:
         , burstSize_(burstSize)
         , name_(get(keyValues, "path"))
         , blockSize_(parseBlockSize(name_, keyValues, journal))
+        , dictionary_(parseDictionary(keyValues, journal))
         , deletePath_(false)
         , scheduler_(scheduler)
     {
@@ -89,6 +92,7 @@ public:
         , burstSize_(burstSize)
         , name_(get(keyValues, "path"))
         , blockSize_(parseBlockSize(name_, keyValues, journal))
+        , dictionary_(parseDictionary(keyValues, journal))
         , db_(context)
         , deletePath_(false)
         , scheduler_(scheduler)
@@ -262,7 +266,8 @@ public:
         EncodedBlob e(no);
         nudb::error_code ec;
         nudb::detail::buffer bf;
-        auto const result = nodeobject_compress(e.getData(), e.getSize(), bf);
+        auto const result =
+            nodeobject_compress(e.getData(), e.getSize(), bf, dictionary_);
         db_.insert(e.getKey(), result.first, result.second, ec);
         if (ec && ec != nudb::error::key_exists)
             Throw<nudb::system_error>(ec);
@@ -373,6 +378,42 @@ public:
     }
 
 private:
+    // Loads the dictionary to compress new objects with, if any. Objects
+    // compressed with earlier dictionaries must stay readable, so every other
+    // file with the same extension in the same directory is loaded too.
+    static ZstdDictionary const*
+    parseDictionary(Section const& keyValues, beast::Journal journal)
+    {
+        using namespace boost::filesystem;
+
+        std::string file;
+        if (!get_if_exists(keyValues, "compression_dictionary", file))
+            return nullptr;
+
+        path const current(file);
+        auto const& dictionary =
+            ZstdDictionary::add(ZstdDictionary::load(current));
+        JLOG(journal.info()) << "Compressing with zstd dictionary "
+                             << dictionary.id() << " from " << file;
+
+        boost::system::error_code ec;
+        for (directory_iterator it(current.parent_path(), ec), end;
+             !ec && it != end;
+             it.increment(ec))
+        {
+            auto const& p = it->path();
+            if (p.extension() != current.extension() ||
+                p.filename() == current.filename())
+                continue;
+
+            auto const& older = ZstdDictionary::add(ZstdDictionary::load(p));
+            JLOG(journal.debug()) << "Loaded zstd dictionary " << older.id()
+                                  << " from " << p.string();
+        }
+
+        return &dictionary;
+    }
+
     static std::size_t
     parseBlockSize(
         std::string const& name,
@@ -32,7 +32,9 @@
 #include <xrpl/basics/safe_cast.h>
 #include <xrpl/beast/core/CurrentThreadName.h>
 
+#include <algorithm>
 #include <atomic>
+#include <cctype>
 #include <memory>
 
 namespace ripple {
@@ -82,6 +84,21 @@ public:
 
 //------------------------------------------------------------------------------
 
+// The prefix of the metrics of a backend. Each backend has a directory of
+// its own, such as the two of a rotating database, so its name is used.
+static std::string
+metricsName(std::string const& path)
+{
+    auto name =
+        "NodeStore_" + boost::filesystem::path(path).filename().string();
+    std::replace_if(
+        name.begin(),
+        name.end(),
+        [](unsigned char c) { return !std::isalnum(c) && c != '_'; },
+        '_');
+    return name;
+}
+
 class RocksDBBackend : public Backend, public BatchWriter::Callback
 {
 private:
@@ -90,8 +107,8 @@ private:
 public:
     beast::Journal m_journal;
     size_t const m_keyBytes;
-    BatchWriter m_batch;
     std::string m_name;
+    BatchWriter m_batch;
     std::unique_ptr<rocksdb::DB> m_db;
     int fdRequired_ = 2048;
     rocksdb::Options m_options;
@@ -105,10 +122,15 @@ public:
         : m_deletePath(false)
         , m_journal(journal)
         , m_keyBytes(keyBytes)
-        , m_batch(*this, scheduler)
+        , m_name([&]() {
+            std::string path;
+            if (!get_if_exists(keyValues, "path", path))
+                Throw<std::runtime_error>(
+                    "Missing path in RocksDBFactory backend");
+            return path;
+        }())
+        , m_batch(*this, scheduler, metricsName(m_name))
     {
-        if (!get_if_exists(keyValues, "path", m_name))
-            Throw<std::runtime_error>("Missing path in RocksDBFactory backend");
 
         rocksdb::BlockBasedTableOptions table_options;
         m_options.env = env;
@@ -429,6 +451,35 @@ public:
         }
     }
 
+    bool
+    canVisitKeysInUse() const override
+    {
+        return true;
+    }
+
+    void
+    for_each_key(std::function<bool(uint256 const&)> f) override
+    {
+        XRPL_ASSERT(
+            m_db,
+            "ripple::NodeStore::RocksDBBackend::for_each_key : non-null "
+            "database");
+
+        // The iterator reads a consistent view of the database, which
+        // writes made meanwhile don't disturb. Its blocks aren't cached, so
+        // the visit doesn't evict the blocks of recent reads.
+        rocksdb::ReadOptions options;
+        options.fill_cache = false;
+        std::unique_ptr<rocksdb::Iterator> it(m_db->NewIterator(options));
+
+        for (it->SeekToFirst(); it->Valid(); it->Next())
+        {
+            if (it->key().size() == m_keyBytes &&
+                !f(uint256::fromVoid(it->key().data())))
+                return;
+        }
+    }
+
     int
     getWriteLoad() override
     {
@@ -19,49 +19,76 @@
 
 #include <xrpld/nodestore/detail/BatchWriter.h>
 
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
 namespace ripple {
 namespace NodeStore {
 
-BatchWriter::BatchWriter(Callback& callback, Scheduler& scheduler)
-    : m_callback(callback)
-    , m_scheduler(scheduler)
-    , mWriteLoad(0)
-    , mWritePending(false)
+namespace {
+
+// The batch size adapts to keep writes near this latency. Larger batches
+// cost less per object to write, but hold up the objects queued behind
+// them for longer.
+constexpr std::chrono::milliseconds targetWriteLatency{100};
+
+}  // namespace
+
+BatchWriter::BatchWriter(
+    Callback& callback,
+    Scheduler& scheduler,
+    std::string const& name)
+    : m_callback(callback), m_scheduler(scheduler)
 {
-    mWriteSet.reserve(batchWritePreallocationSize);
+    auto const collector = scheduler.collector();
+    mQueueDepth = collector->make_gauge(name, "write_queue");
+    mBatchSizeGauge = collector->make_gauge(name, "write_batch_size");
+    mWriteLatency = collector->make_event(name, "write_latency");
+    mStalls = collector->make_counter(name, "write_stalls");
+    mHook = collector->make_hook([this]() {
+        mQueueDepth = mQueued.load(std::memory_order_relaxed);
+        mBatchSizeGauge = mBatchSize.load(std::memory_order_relaxed);
+    });
 }
 
 BatchWriter::~BatchWriter()
 {
     waitForWriting();
+    mHook = beast::insight::Hook();
 }
 
 void
 BatchWriter::store(std::shared_ptr<NodeObject> const& object)
 {
-    std::unique_lock<decltype(mWriteMutex)> sl(mWriteMutex);
-
-    // If the batch has reached its limit, we wait
-    // until the batch writer is finished
-    while (mWriteSet.size() >= batchWriteLimitSize)
-        mWriteCondition.wait(sl);
-
-    mWriteSet.push_back(object);
-
-    if (!mWritePending)
+    // If too many objects are queued, we wait
+    // until the batch writer catches up
+    auto queued = mQueued.load();
+    if (queued >= batchWriteLimitSize)
     {
-        mWritePending = true;
+        ++mStalls;
+        do
+        {
+            mQueued.wait(queued);
+            queued = mQueued.load();
+        } while (queued >= batchWriteLimitSize);
+    }
+
+    mQueued.fetch_add(1);
+    auto const entry = new Entry{object, mQueue.load()};
+    while (!mQueue.compare_exchange_weak(entry->next, entry))
+        ;
 
+    if (!mWritePending.exchange(true))
         m_scheduler.scheduleTask(*this);
-    }
 }
 
 int
 BatchWriter::getWriteLoad()
 {
-    std::lock_guard sl(mWriteMutex);
-
-    return std::max(mWriteLoad, static_cast<int>(mWriteSet.size()));
+    return std::max(
+        mWriteLoad.load(std::memory_order_relaxed),
+        static_cast<int>(mQueued.load(std::memory_order_relaxed)));
 }
 
 void
@@ -73,51 +100,91 @@ BatchWriter::performScheduledTask()
 void
 BatchWriter::writeBatch()
 {
+    Batch batch;
+    batch.reserve(batchWritePreallocationSize);
+
     for (;;)
     {
-        std::vector<std::shared_ptr<NodeObject>> set;
-
-        set.reserve(batchWritePreallocationSize);
-
+        // Take everything queued so far, and restore the order it was
+        // queued in
+        Entry* queue = mQueue.exchange(nullptr);
+        if (!queue)
         {
             std::lock_guard sl(mWriteMutex);
+            mWritePending = false;
 
-            mWriteSet.swap(set);
-            XRPL_ASSERT(
-                mWriteSet.empty(),
-                "ripple::NodeStore::BatchWriter::writeBatch : writes not set");
-            mWriteLoad = set.size();
+            // An object queued after the exchange, by a caller which saw
+            // this write pending, is written by this write. Unless another
+            // write was scheduled in the meantime.
+            if (mQueue.load() && !mWritePending.exchange(true))
+                continue;
 
-            if (set.empty())
-            {
-                mWritePending = false;
-                mWriteCondition.notify_all();
+            mWriteLoad = 0;
+            mWriteCondition.notify_all();
+            return;
+        }
+
+        Entry* ordered = nullptr;
+        while (queue)
+        {
+            auto const next = queue->next;
+            queue->next = ordered;
+            ordered = queue;
+            queue = next;
+        }
 
-                // VFALCO NOTE Fix this function to not return from the middle
-                return;
+        while (ordered)
+        {
+            auto const size = mBatchSize.load(std::memory_order_relaxed);
+            while (ordered && batch.size() < size)
+            {
+                batch.push_back(std::move(ordered->object));
+                delete std::exchange(ordered, ordered->next);
             }
+
+            write(batch);
+            batch.clear();
         }
+    }
+}
 
-        BatchWriteReport report;
-        report.writeCount = set.size();
-        auto const before = std::chrono::steady_clock::now();
+void
+BatchWriter::write(Batch& batch)
+{
+    using namespace std::chrono;
 
-        m_callback.writeBatch(set);
+    mWriteLoad = static_cast<int>(batch.size());
 
-        report.elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::steady_clock::now() - before);
+    BatchWriteReport report;
+    report.writeCount = batch.size();
+    auto const before = steady_clock::now();
 
-        m_scheduler.onBatchWrite(report);
-    }
+    m_callback.writeBatch(batch);
+
+    auto const elapsed = steady_clock::now() - before;
+    report.elapsed = duration_cast<milliseconds>(elapsed);
+    m_scheduler.onBatchWrite(report);
+    mWriteLatency.notify(elapsed);
+
+    // Shrink the batches quickly when writes are slow, and grow them slowly
+    // when full batches are written quickly
+    auto const size = mBatchSize.load(std::memory_order_relaxed);
+    if (elapsed > targetWriteLatency)
+        mBatchSize = std::max<std::size_t>(
+            batch.size() / 2, batchWritePreallocationSize);
+    else if (elapsed < targetWriteLatency / 2 && batch.size() == size)
+        mBatchSize =
+            std::min<std::size_t>(size + size / 4, batchWriteLimitSize);
+
+    mQueued.fetch_sub(batch.size());
+    mQueued.notify_all();
 }
 
 void
 BatchWriter::waitForWriting()
 {
-    std::unique_lock<decltype(mWriteMutex)> sl(mWriteMutex);
-
-    while (mWritePending)
-        mWriteCondition.wait(sl);
+    std::unique_lock sl(mWriteMutex);
+    mWriteCondition.wait(sl, [this] { return !mWritePending.load(); });
 }
 
 }  // namespace NodeStore
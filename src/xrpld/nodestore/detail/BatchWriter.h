@@ -24,8 +24,15 @@
 #include <xrpld/nodestore/Task.h>
 #include <xrpld/nodestore/Types.h>
 
+#include <xrpl/beast/insight/Counter.h>
+#include <xrpl/beast/insight/Event.h>
+#include <xrpl/beast/insight/Gauge.h>
+#include <xrpl/beast/insight/Hook.h>
+
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
+#include <string>
 
 namespace ripple {
 namespace NodeStore {
@@ -36,6 +43,16 @@ namespace NodeStore {
     class it not required. A backend can implement its own write batching,
     or skip write batching if doing so yields a performance benefit.
 
+    Objects to store are pushed onto a lock-free queue, so the many threads
+    which store nodes when a ledger closes don't contend with each other or
+    with the writer. The writer takes everything queued at once, and writes
+    it in batches whose size adapts to how long the backend takes to write
+    them. Callers wait only when too many objects are queued.
+
+    The queue depth, batch size, write latency and the number of times a
+    caller had to wait are reported to the collector of the scheduler, under
+    the name of the writer.
+
     @see Scheduler
 */
 class BatchWriter : private Task
@@ -54,8 +71,15 @@ public:
         writeBatch(Batch const& batch) = 0;
     };
 
-    /** Create a batch writer. */
-    BatchWriter(Callback& callback, Scheduler& scheduler);
+    /** Create a batch writer.
+
+        @param name The prefix of the metrics of this writer, which must
+                    differ from that of every other writer.
+    */
+    BatchWriter(
+        Callback& callback,
+        Scheduler& scheduler,
+        std::string const& name);
 
     /** Destroy a batch writer.
 
@@ -75,25 +99,54 @@ public:
     int
     getWriteLoad();
 
+    /** Wait until every object stored so far has been written. */
+    void
+    waitForWriting();
+
+    /** Return the most objects written in one batch. */
+    std::size_t
+    getBatchSize() const
+    {
+        return mBatchSize.load(std::memory_order_relaxed);
+    }
+
 private:
+    // An object in the queue
+    struct Entry
+    {
+        std::shared_ptr<NodeObject> object;
+        Entry* next;
+    };
+
     void
     performScheduledTask() override;
     void
     writeBatch();
     void
-    waitForWriting();
+    write(Batch& batch);
 
 private:
-    using LockType = std::recursive_mutex;
-    using CondvarType = std::condition_variable_any;
-
     Callback& m_callback;
     Scheduler& m_scheduler;
-    LockType mWriteMutex;
-    CondvarType mWriteCondition;
-    int mWriteLoad;
-    bool mWritePending;
-    Batch mWriteSet;
+
+    // The queue, newest first
+    std::atomic<Entry*> mQueue{nullptr};
+    std::atomic<std::size_t> mQueued{0};
+
+    // Whether a write is scheduled or running
+    std::atomic<bool> mWritePending{false};
+    std::atomic<int> mWriteLoad{0};
+    std::atomic<std::size_t> mBatchSize{batchWriteLimitSize};
+
+    // Only used to wait for the writer to finish
+    std::mutex mWriteMutex;
+    std::condition_variable mWriteCondition;
+
+    beast::insight::Gauge mQueueDepth;
+    beast::insight::Gauge mBatchSizeGauge;
+    beast::insight::Event mWriteLatency;
+    beast::insight::Counter mStalls;
+    beast::insight::Hook mHook;
 };
 
 }  // namespace NodeStore
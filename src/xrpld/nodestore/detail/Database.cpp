@@ -181,6 +181,16 @@ Database::stop()
                      << " millseconds";
 }
 
+std::vector<std::shared_ptr<NodeObject>>
+Database::fetchBatch(std::vector<uint256> const& hashes)
+{
+    std::vector<std::shared_ptr<NodeObject>> results;
+    results.reserve(hashes.size());
+    for (auto const& hash : hashes)
+        results.push_back(fetchNodeObject(hash));
+    return results;
+}
+
 void
 Database::asyncFetch(
     uint256 const& hash,
@@ -19,6 +19,10 @@
 
 #include <xrpld/nodestore/detail/DatabaseNodeImp.h>
 
+#include <xrpl/beast/core/CurrentThreadName.h>
+
+#include <chrono>
+
 namespace ripple {
 namespace NodeStore {
 
@@ -27,12 +31,18 @@ DatabaseNodeImp::store(
     NodeObjectType type,
     Blob&& data,
     uint256 const& hash,
-    std::uint32_t)
+    std::uint32_t ledgerSeq)
 {
     storeStats(1, data.size());
 
     auto obj = NodeObject::createObject(type, std::move(data), hash);
-    backend_->store(obj);
+    // Added before the object is stored, so a fetch never misses it
+    if (keyFilter_)
+        keyFilter_->insert(hash);
+    if (hotTier_)
+        hotTier_->store(obj, ledgerSeq);
+    else
+        backend_->store(obj);
     if (cache_)
     {
         // After the store, replace a negative cache entry if there is one
@@ -58,6 +68,11 @@ DatabaseNodeImp::asyncFetch(
             return;
         }
     }
+    if (auto obj = fetchHot(hash))
+    {
+        callback(obj);
+        return;
+    }
     Database::asyncFetch(hash, ledgerSeq, std::move(callback));
 }
 
@@ -66,6 +81,137 @@ DatabaseNodeImp::sweep()
 {
     if (cache_)
         cache_->sweep();
+    if (hotTier_)
+        hotTier_->sweep();
+}
+
+void
+DatabaseNodeImp::getCountsJson(Json::Value& obj)
+{
+    Database::getCountsJson(obj);
+
+    if (hotTier_)
+    {
+        auto const counts = hotTier_->getCounts();
+        obj["node_hot_objects"] = std::to_string(counts.objects);
+        obj["node_hot_bytes"] = std::to_string(counts.bytes);
+        obj["node_hot_evictions"] = std::to_string(counts.evictions);
+        obj["node_reads_hot"] = std::to_string(hotReads_);
+        obj["node_reads_hot_hit"] = std::to_string(hotHits_);
+        obj["node_reads_cold"] = std::to_string(coldReads_);
+        obj["node_reads_cold_hit"] = std::to_string(coldHits_);
+    }
+
+    if (keyFilter_)
+    {
+        obj["node_filter_ready"] = std::to_string(keyFilterReady_.load());
+        obj["node_filter_bytes"] = std::to_string(keyFilter_->size());
+        obj["node_filter_negatives"] = std::to_string(filterNegatives_);
+        obj["node_filter_false_positives"] =
+            std::to_string(filterFalsePositives_);
+    }
+}
+
+void
+DatabaseNodeImp::buildKeyFilter()
+{
+    // After an import the backend holds keys the filter lacks, so the
+    // filter isn't consulted again until it has them all
+    stopKeyFilter();
+    keyFilterReady_ = false;
+    keyFilterStop_ = false;
+
+    // Keys stored meanwhile are added by store. A backend which can't list
+    // its keys while in use is read now, before anything else uses it.
+    if (!backend_->canVisitKeysInUse())
+    {
+        fillKeyFilter();
+        return;
+    }
+
+    keyFilterThread_ = std::thread([this]() {
+        beast::setCurrentThreadName("KeyFilter");
+        try
+        {
+            fillKeyFilter();
+        }
+        catch (std::exception const& e)
+        {
+            JLOG(j_.warn()) << "Key filter not built: " << e.what();
+        }
+    });
+}
+
+void
+DatabaseNodeImp::fillKeyFilter()
+{
+    using namespace std::chrono;
+    auto const start = steady_clock::now();
+
+    std::uint64_t keys = 0;
+    if (backend_->canVisitKeysInUse())
+    {
+        backend_->for_each_key([&](uint256 const& key) {
+            keyFilter_->insert(key);
+            ++keys;
+            return !keyFilterStop_.load(std::memory_order_relaxed);
+        });
+    }
+    else
+    {
+        backend_->for_each([&](std::shared_ptr<NodeObject> nodeObject) {
+            keyFilter_->insert(nodeObject->getHash());
+            ++keys;
+        });
+    }
+
+    if (keyFilterStop_)
+        return;
+
+    keyFilterReady_.store(true, std::memory_order_release);
+    JLOG(j_.info()) << "Key filter of " << keyFilter_->size()
+                    << " bytes built from " << keys << " objects in "
+                    << duration_cast<milliseconds>(steady_clock::now() - start)
+                           .count()
+                    << "ms";
+}
+
+void
+DatabaseNodeImp::stopKeyFilter()
+{
+    keyFilterStop_ = true;
+    if (keyFilterThread_.joinable())
+        keyFilterThread_.join();
+}
+
+bool
+DatabaseNodeImp::mayContain(uint256 const& hash)
+{
+    if (!keyFilter_ ||
+        !keyFilterReady_.load(std::memory_order_acquire) ||
+        keyFilter_->mayContain(hash))
+        return true;
+
+    ++filterNegatives_;
+    return false;
+}
+
+std::shared_ptr<NodeObject>
+DatabaseNodeImp::fetchHot(uint256 const& hash)
+{
+    if (!hotTier_)
+        return nullptr;
+
+    ++hotReads_;
+    auto nodeObject = hotTier_->fetch(hash);
+    if (nodeObject)
+    {
+        ++hotHits_;
+        // Ensure all threads get the same object
+        if (cache_)
+            cache_->canonicalize_replace_client(hash, nodeObject);
+    }
+    return nodeObject;
 }
 
 std::shared_ptr<NodeObject>
@@ -78,6 +224,16 @@ DatabaseNodeImp::fetchNodeObject(
     std::shared_ptr<NodeObject> nodeObject =
         cache_ ? cache_->fetch(hash) : nullptr;
 
+    if (!nodeObject)
+        nodeObject = fetchHot(hash);
+
+    if (!nodeObject && !mayContain(hash))
+    {
+        JLOG(j_.trace()) << "fetchNodeObject " << hash
+                         << ": record not in key filter";
+        return nullptr;
+    }
+
     if (!nodeObject)
     {
         JLOG(j_.trace()) << "fetchNodeObject " << hash << ": record not "
@@ -87,6 +243,7 @@ DatabaseNodeImp::fetchNodeObject(
 
         try
         {
+            ++coldReads_;
             status = backend_->fetch(hash.data(), &nodeObject);
         }
         catch (std::exception const& e)
@@ -100,6 +257,10 @@ DatabaseNodeImp::fetchNodeObject(
         switch (status)
         {
             case ok:
+                if (nodeObject)
+                    ++coldHits_;
+                else if (keyFilterReady_)
+                    ++filterFalsePositives_;
                 if (cache_)
                 {
                     if (nodeObject)
@@ -115,6 +276,8 @@ DatabaseNodeImp::fetchNodeObject(
                 }
                 break;
             case notFound:
+                if (keyFilterReady_)
+                    ++filterFalsePositives_;
                 break;
             case dataCorrupt:
                 JLOG(j_.fatal()) << "fetchNodeObject " << hash
@@ -156,7 +319,14 @@ DatabaseNodeImp::fetchBatch(std::vector<uint256> const& hashes)
         auto const& hash = hashes[i];
         // See if the object already exists in the cache
         auto nObj = cache_ ? cache_->fetch(hash) : nullptr;
+        if (!nObj)
+            nObj = fetchHot(hash);
         ++fetches;
+        if (!nObj && !mayContain(hash))
+        {
+            // Certainly not in the database
+            continue;
+        }
         if (!nObj)
         {
             // Try the database
@@ -175,6 +345,7 @@ DatabaseNodeImp::fetchBatch(std::vector<uint256> const& hashes)
                      << (hashes.size() - cacheMisses.size())
                      << " - cache misses = " << cacheMisses.size();
     auto dbResults = backend_->fetchBatch(cacheMisses).first;
+    coldReads_ += cacheMisses.size();
 
     for (size_t i = 0; i < dbResults.size(); ++i)
     {
@@ -184,12 +355,15 @@ DatabaseNodeImp::fetchBatch(std::vector<uint256> const& hashes)
 
         if (nObj)
         {
+            ++coldHits_;
             // Ensure all threads get the same object
             if (cache_)
                 cache_->canonicalize_replace_client(hash, nObj);
         }
         else
         {
+            if (keyFilterReady_)
+                ++filterFalsePositives_;
             JLOG(j_.error())
                 << "fetchBatch - "
                 << "record not found in db or cache. hash = " << strHex(hash);
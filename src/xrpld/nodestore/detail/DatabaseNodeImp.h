@@ -21,10 +21,15 @@
 #define RIPPLE_NODESTORE_DATABASENODEIMP_H_INCLUDED
 
 #include <xrpld/nodestore/Database.h>
+#include <xrpld/nodestore/detail/HotTier.h>
+#include <xrpld/nodestore/detail/KeyFilter.h>
 
-#include <xrpl/basics/TaggedCache.h>
+#include <xrpl/basics/ShardedTaggedCache.h>
 #include <xrpl/basics/chrono.h>
 
+#include <atomic>
+#include <thread>
+
 namespace ripple {
 namespace NodeStore {
 
@@ -69,7 +74,7 @@ public:
 
         if (cacheSize != 0 || cacheAge != 0)
         {
-            cache_ = std::make_shared<TaggedCache<uint256, NodeObject>>(
+            cache_ = std::make_shared<ShardedTaggedCache<uint256, NodeObject>>(
                 "DatabaseNodeImp",
                 cacheSize.value_or(0),
                 std::chrono::minutes(cacheAge.value_or(0)),
@@ -81,10 +86,23 @@ public:
             backend_,
             "ripple::NodeStore::DatabaseNodeImp::DatabaseNodeImp : non-null "
             "backend");
+
+        if (auto const ledgers = get<std::uint32_t>(config, "hot_ledgers"))
+        {
+            hotTier_ = std::make_unique<HotTier>(
+                *backend_, scheduler, ledgers, j);
+        }
+
+        if (auto const keys = get<std::uint64_t>(config, "key_filter_size"))
+        {
+            keyFilter_ = std::make_unique<KeyFilter>(keys);
+            buildKeyFilter();
+        }
     }
 
     ~DatabaseNodeImp()
     {
+        stopKeyFilter();
         stop();
     }
 
@@ -97,13 +115,16 @@ public:
     std::int32_t
     getWriteLoad() const override
     {
-        return backend_->getWriteLoad();
+        return backend_->getWriteLoad() +
+            (hotTier_ ? hotTier_->getWriteLoad() : 0);
     }
 
     void
     importDatabase(Database& source) override
     {
         importInternal(*backend_.get(), source);
+        if (keyFilter_)
+            buildKeyFilter();
     }
 
     void
@@ -120,11 +141,13 @@ public:
     void
     sync() override
     {
+        if (hotTier_)
+            hotTier_->flush();
         backend_->sync();
     }
 
     std::vector<std::shared_ptr<NodeObject>>
-    fetchBatch(std::vector<uint256> const& hashes);
+    fetchBatch(std::vector<uint256> const& hashes) override;
 
     void
     asyncFetch(
@@ -136,12 +159,64 @@ public:
     void
     sweep() override;
 
+    void
+    getCountsJson(Json::Value& obj) override;
+
 private:
     // Cache for database objects. This cache is not always initialized. Check
     // for null before using.
-    std::shared_ptr<TaggedCache<uint256, NodeObject>> cache_;
+    std::shared_ptr<ShardedTaggedCache<uint256, NodeObject>> cache_;
     // Persistent key/value storage
     std::shared_ptr<Backend> backend_;
+    // The objects of the most recent ledgers, in front of the backend. This
+    // is only created if configured. Check for null before using.
+    std::unique_ptr<HotTier> hotTier_;
+
+    // Reads which reached each tier, and how many of them found the object
+    std::atomic<std::uint64_t> hotReads_{0};
+    std::atomic<std::uint64_t> hotHits_{0};
+    std::atomic<std::uint64_t> coldReads_{0};
+    std::atomic<std::uint64_t> coldHits_{0};
+
+    // The keys of every object in the backend. This is only created if
+    // configured. Check for null before using.
+    std::unique_ptr<KeyFilter> keyFilter_;
+
+    // Set once the filter holds every key in the backend. Until then, it
+    // isn't consulted.
+    std::atomic<bool> keyFilterReady_{false};
+
+    // The thread which adds the keys in the backend to the filter, and a
+    // flag which tells it to give up
+    std::thread keyFilterThread_;
+    std::atomic<bool> keyFilterStop_{false};
+
+    // Reads which the filter answered without the backend, and reads which
+    // it passed to the backend for objects that were not there
+    std::atomic<std::uint64_t> filterNegatives_{0};
+    std::atomic<std::uint64_t> filterFalsePositives_{0};
+
+    // Starts adding the key of every object in the backend to the filter,
+    // in the background if the backend allows it
+    void
+    buildKeyFilter();
+
+    // Adds the key of every object in the backend to the filter, then marks
+    // the filter ready
+    void
+    fillKeyFilter();
+
+    // Stops and waits for the thread building the filter, if there is one
+    void
+    stopKeyFilter();
+
+    // Returns false if the backend certainly does not hold the object
+    bool
+    mayContain(uint256 const& hash);
+
+    // Returns an object from the hot tier, or nullptr
+    std::shared_ptr<NodeObject>
+    fetchHot(uint256 const& hash);
 
     std::shared_ptr<NodeObject>
     fetchNodeObject(
@@ -153,6 +228,8 @@ private:
     void
     for_each(std::function<void(std::shared_ptr<NodeObject>)> f) override
     {
+        if (hotTier_)
+            hotTier_->flush();
         backend_->for_each(f);
     }
 };
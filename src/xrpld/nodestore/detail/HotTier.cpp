@@ -0,0 +1,140 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <xrpld/nodestore/detail/HotTier.h>
+
+#include <xrpl/basics/Log.h>
+
+namespace ripple {
+namespace NodeStore {
+
+HotTier::HotTier(
+    Backend& cold,
+    Scheduler& scheduler,
+    std::uint32_t ledgers,
+    beast::Journal j)
+    : cold_(cold)
+    , ledgers_(ledgers)
+    , j_(j)
+    , writer_(*this, scheduler, "NodeStore_hot")
+{
+}
+
+void
+HotTier::store(
+    std::shared_ptr<NodeObject> const& object,
+    std::uint32_t ledgerSeq)
+{
+    auto latest = latest_.load();
+    while (latest < ledgerSeq &&
+           !latest_.compare_exchange_weak(latest, ledgerSeq))
+        ;
+
+    {
+        auto& s = shard(object->getHash());
+        std::lock_guard lock(s.mutex);
+        auto const [it, inserted] =
+            s.map.try_emplace(object->getHash(), Entry{object, ledgerSeq});
+        if (!inserted)
+        {
+            // Already stored, by this or an earlier ledger. Keep it for as
+            // long as the latest ledger to store it is held.
+            it->second.ledgerSeq = std::max(it->second.ledgerSeq, ledgerSeq);
+            return;
+        }
+    }
+
+    ++objects_;
+    bytes_ += object->getData().size();
+    writer_.store(object);
+}
+
+std::shared_ptr<NodeObject>
+HotTier::fetch(uint256 const& hash) const
+{
+    auto& s = shard(hash);
+    std::lock_guard lock(s.mutex);
+    auto const it = s.map.find(hash);
+    return it == s.map.end() ? nullptr : it->second.object;
+}
+
+void
+HotTier::writeBatch(Batch const& batch)
+{
+    cold_.storeBatch(batch);
+
+    for (auto const& object : batch)
+    {
+        auto& s = shard(object->getHash());
+        std::lock_guard lock(s.mutex);
+        if (auto const it = s.map.find(object->getHash()); it != s.map.end())
+            it->second.written = true;
+    }
+}
+
+void
+HotTier::sweep()
+{
+    auto const latest = latest_.load();
+    if (latest < ledgers_)
+        return;
+    auto const oldest = latest - ledgers_ + 1;
+
+    std::size_t evicted = 0;
+    std::uint64_t bytes = 0;
+    for (auto& s : shards_)
+    {
+        std::lock_guard lock(s.mutex);
+        for (auto it = s.map.begin(); it != s.map.end();)
+        {
+            if (it->second.ledgerSeq < oldest && it->second.written)
+            {
+                ++evicted;
+                bytes += it->second.object->getData().size();
+                it = s.map.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    objects_ -= evicted;
+    bytes_ -= bytes;
+    evictions_ += evicted;
+
+    JLOG(j_.debug()) << "Evicted " << evicted << " objects older than ledger "
+                     << oldest << ", " << objects_.load() << " remain";
+}
+
+void
+HotTier::flush()
+{
+    writer_.waitForWriting();
+}
+
+HotTier::Counts
+HotTier::getCounts() const
+{
+    return {objects_.load(), bytes_.load(), evictions_.load()};
+}
+
+}  // namespace NodeStore
+}  // namespace ripple
@@ -0,0 +1,146 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#ifndef RIPPLE_NODESTORE_HOTTIER_H_INCLUDED
+#define RIPPLE_NODESTORE_HOTTIER_H_INCLUDED
+
+#include <xrpld/nodestore/Backend.h>
+#include <xrpld/nodestore/Scheduler.h>
+#include <xrpld/nodestore/detail/BatchWriter.h>
+
+#include <xrpl/basics/hardened_hash.h>
+#include <xrpl/beast/utility/Journal.h>
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+namespace ripple {
+namespace NodeStore {
+
+/** The objects stored by the most recent ledgers, held in memory.
+
+    Most reads are for the nodes of the last few hundred ledgers, which
+    the caches only hold for as long as they have room. The hot tier holds
+    every object stored by the most recent ledgers, so reads of those never
+    reach the backend, which becomes the cold tier.
+
+    Objects are written to the cold tier in the background as they are
+    stored. They are evicted from the hot tier by a sweep once they are
+    both written and older than the ledgers the tier holds.
+*/
+class HotTier : private BatchWriter::Callback
+{
+public:
+    /** Create the hot tier.
+
+        @param cold The backend to write the objects to.
+        @param ledgers The number of most recent ledgers to hold objects for.
+    */
+    HotTier(
+        Backend& cold,
+        Scheduler& scheduler,
+        std::uint32_t ledgers,
+        beast::Journal j);
+
+    /** Add an object stored by a ledger, and write it to the cold tier. */
+    void
+    store(std::shared_ptr<NodeObject> const& object, std::uint32_t ledgerSeq);
+
+    /** Return an object in the hot tier, or nullptr. */
+    std::shared_ptr<NodeObject>
+    fetch(uint256 const& hash) const;
+
+    /** Evict the objects that have been written to the cold tier and are
+        older than the ledgers the tier holds.
+    */
+    void
+    sweep();
+
+    /** Wait until every object stored so far is in the cold tier. */
+    void
+    flush();
+
+    /** Return the number of objects not yet written to the cold tier. */
+    int
+    getWriteLoad()
+    {
+        return writer_.getWriteLoad();
+    }
+
+    struct Counts
+    {
+        std::size_t objects;
+        std::uint64_t bytes;
+        std::uint64_t evictions;
+    };
+
+    Counts
+    getCounts() const;
+
+private:
+    void
+    writeBatch(Batch const& batch) override;
+
+    struct Entry
+    {
+        std::shared_ptr<NodeObject> object;
+        std::uint32_t ledgerSeq;
+        bool written;
+    };
+
+    // Objects are spread over shards by hash, so stores and fetches of
+    // different objects rarely contend.
+    struct Shard
+    {
+        std::mutex mutex;
+        std::unordered_map<uint256, Entry, hardened_hash<>> map;
+    };
+
+    static constexpr std::size_t shardCount = 64;
+
+    Shard&
+    shard(uint256 const& hash) const
+    {
+        return shards_[*hash.data() % shardCount];
+    }
+
+    Backend& cold_;
+    std::uint32_t const ledgers_;
+    beast::Journal const j_;
+
+    mutable std::array<Shard, shardCount> shards_;
+
+    // The latest ledger to store an object
+    std::atomic<std::uint32_t> latest_{0};
+
+    std::atomic<std::size_t> objects_{0};
+    std::atomic<std::uint64_t> bytes_{0};
+    std::atomic<std::uint64_t> evictions_{0};
+
+    // Declared last, so everything queued is written before the rest of the
+    // tier is destroyed
+    BatchWriter writer_;
+};
+
+}  // namespace NodeStore
+}  // namespace ripple
+
+#endif
@@ -0,0 +1,78 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <xrpld/nodestore/detail/KeyFilter.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace ripple {
+namespace NodeStore {
+
+KeyFilter::KeyFilter(std::uint64_t keys)
+    : words_(std::max<std::uint64_t>(1, (keys * bitsPerKey + 63) / 64))
+    , bits_(std::make_unique<std::atomic<std::uint64_t>[]>(words_))
+{
+}
+
+template <class F>
+void
+KeyFilter::forEachBit(uint256 const& key, F&& f) const
+{
+    // Derive the bits from two independent parts of the key, as in
+    // Kirsch and Mitzenmacher, "Less Hashing, Same Performance".
+    std::uint64_t h1;
+    std::uint64_t h2;
+    std::memcpy(&h1, key.data(), sizeof(h1));
+    std::memcpy(&h2, key.data() + sizeof(h1), sizeof(h2));
+    h2 |= 1;
+
+    auto const bits = words_ * 64;
+    for (int i = 0; i < hashes; ++i)
+    {
+        auto const bit = (h1 + i * h2) % bits;
+        if (!f(bits_[bit / 64], std::uint64_t{1} << (bit % 64)))
+            return;
+    }
+}
+
+void
+KeyFilter::insert(uint256 const& key)
+{
+    forEachBit(key, [](std::atomic<std::uint64_t>& word, std::uint64_t mask) {
+        if ((word.load(std::memory_order_relaxed) & mask) == 0)
+            word.fetch_or(mask, std::memory_order_release);
+        return true;
+    });
+}
+
+bool
+KeyFilter::mayContain(uint256 const& key) const
+{
+    bool found = true;
+    forEachBit(
+        key, [&](std::atomic<std::uint64_t> const& word, std::uint64_t mask) {
+            found = (word.load(std::memory_order_acquire) & mask) != 0;
+            return found;
+        });
+    return found;
+}
+
+}  // namespace NodeStore
+}  // namespace ripple
@@ -0,0 +1,87 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#ifndef RIPPLE_NODESTORE_KEYFILTER_H_INCLUDED
+#define RIPPLE_NODESTORE_KEYFILTER_H_INCLUDED
+
+#include <xrpl/basics/base_uint.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace ripple {
+namespace NodeStore {
+
+/** A Bloom filter of the keys in a node store.
+
+    If the filter does not contain a key, the key was never added, so a
+    fetch of it can be answered without reading the backend. If the filter
+    contains a key, the key was probably added. The rate of false positives
+    is about 1% while no more keys are added than the filter was sized for,
+    and grows as more are.
+
+    Keys are added and checked concurrently without a lock. Keys are
+    hashes, so their bits are used as the hashes of the filter.
+*/
+class KeyFilter
+{
+public:
+    /** Create an empty filter.
+
+        @param keys The number of keys to size the filter for.
+    */
+    explicit KeyFilter(std::uint64_t keys);
+
+    KeyFilter(KeyFilter const&) = delete;
+    KeyFilter&
+    operator=(KeyFilter const&) = delete;
+
+    void
+    insert(uint256 const& key);
+
+    /** Returns false if the key was never added. */
+    bool
+    mayContain(uint256 const& key) const;
+
+    /** Returns the size of the filter in bytes. */
+    std::uint64_t
+    size() const
+    {
+        return words_ * sizeof(std::uint64_t);
+    }
+
+private:
+    // With ten bits for each key, seven hashes give the fewest false
+    // positives.
+    static constexpr std::uint64_t bitsPerKey = 10;
+    static constexpr int hashes = 7;
+
+    template <class F>
+    void
+    forEachBit(uint256 const& key, F&& f) const;
+
+    std::uint64_t const words_;
+    std::unique_ptr<std::atomic<std::uint64_t>[]> const bits_;
+};
+
+}  // namespace NodeStore
+}  // namespace ripple
+
+#endif
@@ -23,6 +23,7 @@
 // Disable lz4 deprecation warning due to incompatibility with clang attributes
 #define LZ4_DISABLE_DEPRECATE_WARNINGS
 
+#include <xrpld/core/ZstdDictionary.h>
 #include <xrpld/nodestore/NodeObject.h>
 #include <xrpld/nodestore/detail/varint.h>
 
@@ -36,6 +37,7 @@
 
 #include <cstddef>
 #include <cstring>
+#include <limits>
 #include <string>
 
 namespace ripple {
@@ -95,6 +97,58 @@ lz4_compress(void const* in, std::size_t in_size, BufferFactory&& bf)
     return result;
 }
 
+template <class BufferFactory>
+std::pair<void const*, std::size_t>
+zstd_decompress(void const* in, std::size_t in_size, BufferFactory&& bf)
+{
+    auto const p = reinterpret_cast<std::uint8_t const*>(in);
+
+    std::size_t id = 0;
+    auto const n1 = read_varint(p, in_size, id);
+    if (n1 == 0 || n1 >= in_size)
+        Throw<std::runtime_error>("zstd_decompress: invalid blob");
+
+    std::size_t outSize = 0;
+    auto const n2 = read_varint(p + n1, in_size - n1, outSize);
+    if (n2 == 0 || n1 + n2 >= in_size)
+        Throw<std::runtime_error>("zstd_decompress: invalid blob");
+
+    if (id > std::numeric_limits<std::uint32_t>::max())
+        Throw<std::runtime_error>("zstd_decompress: invalid dictionary");
+    auto const dictionary =
+        ZstdDictionary::find(static_cast<std::uint32_t>(id));
+    if (!dictionary)
+        Throw<std::runtime_error>(
+            "zstd_decompress: unknown dictionary " + std::to_string(id));
+
+    void* const out = bf(outSize);
+
+    if (dictionary->decompress(
+            p + n1 + n2, in_size - n1 - n2, out, outSize) != outSize)
+        Throw<std::runtime_error>("zstd_decompress: size mismatch");
+
+    return {out, outSize};
+}
+
+template <class BufferFactory>
+std::pair<void const*, std::size_t>
+zstd_compress(
+    void const* in,
+    std::size_t in_size,
+    ZstdDictionary const& dictionary,
+    BufferFactory&& bf)
+{
+    using namespace nudb::detail;
+    std::array<std::uint8_t, 2 * varint_traits<std::size_t>::max> vi;
+    auto n = write_varint(vi.data(), dictionary.id());
+    n += write_varint(vi.data() + n, in_size);
+    auto const out_max = ZstdDictionary::compressBound(in_size);
+    std::uint8_t* out = reinterpret_cast<std::uint8_t*>(bf(n + out_max));
+    std::memcpy(out, vi.data(), n);
+    auto const out_size = dictionary.compress(in, in_size, out + n, out_max);
+    return {out, n + out_size};
+}
+
 //------------------------------------------------------------------------------
 
 /*
@@ -104,6 +158,7 @@ lz4_compress(void const* in, std::size_t in_size, BufferFactory&& bf)
     1 = lz4 compressed
     2 = inner node compressed
     3 = full inner node
+    4 = zstd compressed with a dictionary
 */
 
 template <class BufferFactory>
@@ -202,6 +257,11 @@ nodeobject_decompress(void const* in, std::size_t in_size, BufferFactory&& bf)
             write(os, is(512), 512);
             break;
         }
+        case 4:  // zstd with a dictionary
+        {
+            result = zstd_decompress(p, in_size, bf);
+            break;
+        }
         default:
             Throw<std::runtime_error>(
                 "nodeobject codec: bad type=" + std::to_string(type));
@@ -217,9 +277,18 @@ zero32()
     return v.data();
 }
 
+/** Compress a node object.
+
+    Inner nodes are always stored by the inner node codec. Other objects are
+    compressed with zstd if there is a dictionary, and with LZ4 otherwise.
+*/
 template <class BufferFactory>
 std::pair<void const*, std::size_t>
-nodeobject_compress(void const* in, std::size_t in_size, BufferFactory&& bf)
+nodeobject_compress(
+    void const* in,
+    std::size_t in_size,
+    BufferFactory&& bf,
+    ZstdDictionary const* dictionary = nullptr)
 {
     using std::runtime_error;
     using namespace nudb::detail;
@@ -283,7 +352,7 @@ nodeobject_compress(void const* in, std::size_t in_size, BufferFactory&& bf)
 
     std::array<std::uint8_t, varint_traits<std::size_t>::max> vi;
 
-    constexpr std::size_t codecType = 1;
+    std::size_t const codecType = dictionary ? 4 : 1;
     auto const vn = write_varint(vi.data(), codecType);
     std::pair<void const*, std::size_t> result;
     switch (codecType)
@@ -302,6 +371,19 @@ nodeobject_compress(void const* in, std::size_t in_size, BufferFactory&& bf)
             result.second = vn + lzr.second;
             break;
         }
+        case 4:  // zstd with a dictionary
+        {
+            std::uint8_t* p;
+            auto const zr = NodeStore::zstd_compress(
+                in, in_size, *dictionary, [&p, &vn, &bf](std::size_t n) {
+                    p = reinterpret_cast<std::uint8_t*>(bf(vn + n));
+                    return p + vn;
+                });
+            std::memcpy(p, vi.data(), vn);
+            result.first = p;
+            result.second = vn + zr.second;
+            break;
+        }
         default:
             Throw<std::logic_error>(
                 "nodeobject codec: unknown=" + std::to_string(codecType));
@@ -20,9 +20,16 @@
 #ifndef RIPPLED_COMPRESSION_H_INCLUDED
 #define RIPPLED_COMPRESSION_H_INCLUDED
 
+#include <xrpld/core/ZstdDictionary.h>
+
 #include <xrpl/basics/CompressionAlgorithms.h>
 #include <xrpl/basics/Log.h>
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
 namespace ripple {
 
 namespace compression {
@@ -32,16 +39,82 @@ std::size_t constexpr headerBytesCompressed = 10;
 
 // All values other than 'none' must have the high bit. The low order four bits
 // must be 0.
-enum class Algorithm : std::uint8_t { None = 0x00, LZ4 = 0x90 };
+enum class Algorithm : std::uint8_t { None = 0x00, LZ4 = 0x90, Zstd = 0xA0 };
 
 enum class Compressed : std::uint8_t { On, Off };
 
+/** The zstd dictionaries a server can compress messages with, newest first.
+
+    Both ends of a link must have the same dictionary to use it, so each
+    dictionary's ID serves as its version, and peers negotiate the newest
+    dictionary they both have during the handshake.
+*/
+using Dictionaries = std::vector<std::shared_ptr<ZstdDictionary const>>;
+
+/** zstd decompression with a dictionary.
+ * @tparam InputStream ZeroCopyInputStream
+ * @param in Input source stream
+ * @param inSize Size of compressed data
+ * @param decompressed Buffer to hold decompressed data
+ * @param decompressedSize Size of the decompressed buffer
+ * @param dictionary The dictionary the data was compressed with
+ * @return size of the decompressed data
+ */
+template <typename InputStream>
+std::size_t
+zstdDecompress(
+    InputStream& in,
+    std::size_t inSize,
+    std::uint8_t* decompressed,
+    std::size_t decompressedSize,
+    ZstdDictionary const& dictionary)
+{
+    std::vector<std::uint8_t> compressed;
+    void const* chunk = nullptr;
+    int chunkSize = 0;
+    std::size_t copied = 0;
+
+    // Use the first chunk if it holds the whole compressed message, as it
+    // usually does. Otherwise gather the chunks into one buffer.
+    std::uint8_t const* data = nullptr;
+    while (copied < inSize && in.Next(&chunk, &chunkSize))
+    {
+        auto const size =
+            std::min(static_cast<std::size_t>(chunkSize), inSize - copied);
+        if (copied == 0 && size == inSize)
+            data = static_cast<std::uint8_t const*>(chunk);
+        else
+        {
+            compressed.resize(inSize);
+            std::memcpy(compressed.data() + copied, chunk, size);
+        }
+        copied += size;
+
+        // Put back unused bytes
+        if (size < static_cast<std::size_t>(chunkSize))
+            in.BackUp(chunkSize - static_cast<int>(size));
+    }
+
+    if (copied != inSize)
+        Throw<std::runtime_error>("zstd decompress: insufficient input size");
+
+    if (!data)
+        data = compressed.data();
+
+    if (dictionary.decompress(data, inSize, decompressed, decompressedSize) !=
+        decompressedSize)
+        Throw<std::runtime_error>("zstd decompress: size mismatch");
+
+    return decompressedSize;
+}
+
 /** Decompress input stream.
  * @tparam InputStream ZeroCopyInputStream
  * @param in Input source stream
  * @param inSize Size of compressed data
  * @param decompressed Buffer to hold decompressed message
  * @param algorithm Compression algorithm type
+ * @param dictionary The dictionary to decompress zstd data with
  * @return Size of decompressed data or zero if failed to decompress
  */
 template <typename InputStream>
@@ -51,13 +124,22 @@ decompress(
     std::size_t inSize,
     std::uint8_t* decompressed,
     std::size_t decompressedSize,
-    Algorithm algorithm = Algorithm::LZ4)
+    Algorithm algorithm = Algorithm::LZ4,
+    ZstdDictionary const* dictionary = nullptr)
 {
     try
     {
         if (algorithm == Algorithm::LZ4)
             return ripple::compression_algorithms::lz4Decompress(
                 in, inSize, decompressed, decompressedSize);
+        else if (algorithm == Algorithm::Zstd)
+        {
+            // A peer may only send zstd data if we agreed on a dictionary
+            if (!dictionary)
+                return 0;
+            return zstdDecompress(
+                in, inSize, decompressed, decompressedSize, *dictionary);
+        }
         else
         {
             // LCOV_EXCL_START
@@ -83,6 +165,7 @@ decompress(
  * @param inSize Size of the data
  * @param bf Compressed buffer allocator
  * @param algorithm Compression algorithm type
+ * @param dictionary The dictionary to compress zstd data with
  * @return Size of compressed data, or zero if failed to compress
  */
 template <class BufferFactory>
@@ -91,13 +174,22 @@ compress(
     void const* in,
     std::size_t inSize,
     BufferFactory&& bf,
-    Algorithm algorithm = Algorithm::LZ4)
+    Algorithm algorithm = Algorithm::LZ4,
+    ZstdDictionary const* dictionary = nullptr)
 {
     try
     {
         if (algorithm == Algorithm::LZ4)
             return ripple::compression_algorithms::lz4Compress(
                 in, inSize, std::forward<BufferFactory>(bf));
+        else if (algorithm == Algorithm::Zstd)
+        {
+            if (!dictionary)
+                return 0;
+            auto const outCapacity = ZstdDictionary::compressBound(inSize);
+            return dictionary->compress(
+                in, inSize, bf(outCapacity), outCapacity);
+        }
         else
         {
             // LCOV_EXCL_START
@@ -27,7 +27,10 @@
 #include <xrpl/protocol/messages.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <map>
+#include <mutex>
 
 namespace ripple {
 
@@ -77,10 +80,14 @@ public:
      * the message is not compressible then the uncompressed buffer is returned.
      * @param compressed Request compressed (Compress::On) or
      *     uncompressed (Compress::Off) payload buffer
+     * @param dictionary If set, compress with zstd and this dictionary
+     *     instead of LZ4
      * @return Payload buffer
      */
     std::vector<uint8_t> const&
-    getBuffer(Compressed tryCompressed);
+    getBuffer(
+        Compressed tryCompressed,
+        ZstdDictionary const* dictionary = nullptr);
 
     /** Get the traffic category */
     std::size_t
@@ -101,14 +108,22 @@ private:
     std::vector<uint8_t> bufferCompressed_;
     std::size_t category_;
     std::once_flag once_flag_;
+    // The payload compressed with zstd, for each dictionary a peer asked for.
+    // An empty buffer means the message is not compressible.
+    using ZstdBuffers = std::map<ZstdDictionary const*, std::vector<uint8_t>>;
+    ZstdBuffers bufferZstd_;
+    std::mutex zstdMutex_;
+    // The entry last looked up in bufferZstd_. Peers almost always share the
+    // newest dictionary, so relaying to them finds it here without the lock.
+    std::atomic<ZstdBuffers::value_type const*> zstdRecent_{nullptr};
     std::optional<PublicKey> validatorKey_;
 
     /** Set the payload header
      * @param in Pointer to the payload
      * @param payloadBytes Size of the payload excluding the header size
      * @param type Protocol message type
-     * @param compression Compression algorithm used in compression,
-     *   currently LZ4 only. If None then the message is uncompressed.
+     * @param compression Compression algorithm used in compression.
+     *   If None then the message is uncompressed.
      * @param uncompressedBytes Size of the uncompressed message
      */
     void
@@ -126,6 +141,16 @@ private:
     void
     compress();
 
+    /** Compress the payload with zstd and a dictionary.
+     * @param dictionary The dictionary to compress with
+     * @param compressed Buffer to hold the compressed message, which is left
+     *   empty if the message is not compressible
+     */
+    void
+    compressZstd(
+        ZstdDictionary const& dictionary,
+        std::vector<uint8_t>& compressed);
+
     /** Get the message type from the payload header.
      * First four bytes are the compression/algorithm flag and the payload size.
      * Next two bytes are the message type
@@ -20,6 +20,7 @@
 #ifndef RIPPLE_OVERLAY_OVERLAY_H_INCLUDED
 #define RIPPLE_OVERLAY_OVERLAY_H_INCLUDED
 
+#include <xrpld/overlay/Compression.h>
 #include <xrpld/overlay/Peer.h>
 
 #include <xrpl/beast/utility/PropertyStream.h>
@@ -71,6 +72,7 @@ public:
         std::uint32_t crawlOptions = 0;
         std::optional<std::uint32_t> networkID;
         bool vlEnabled = true;
+        compression::Dictionaries dictionaries;
     };
 
     using PeerSequence = std::vector<std::shared_ptr<Peer>>;
@@ -76,6 +76,11 @@ public:
     virtual void
     removeTxQueue(uint256 const&) = 0;
 
+    /** Aggregate relayed transaction, sent in one batch with the
+        transactions relayed within the aggregation window. */
+    virtual void
+    addTxBatch(std::shared_ptr<protocol::TMTransaction const> const&) = 0;
+
     /** Adjust this peer's load balance based on the type of load imposed. */
     virtual void
     charge(Resource::Charge const& fee, std::string const& context) = 0;
@@ -57,6 +57,10 @@ static constexpr auto WAIT_ON_BOOTUP = std::chrono::minutes{10};
 // TMTransactions from exceeding the current protocol message
 // size limit of 64MB.
 static constexpr std::size_t MAX_TX_QUEUE_SIZE = 10000;
+// Maximum number of relayed transactions aggregated into one
+// TMTransactions per peer. A full batch is sent without waiting
+// for the rest of the aggregation window.
+static constexpr std::size_t MAX_TX_BATCH_SIZE = 256;
 
 }  // namespace reduce_relay
 
@@ -403,6 +403,7 @@ ConnectAttempt::onHandshake(error_code ec)
     req_ = makeRequest(
         !overlay_.peerFinder().config().peerPrivate,
         app_.config().COMPRESSION,
+        overlay_.setup().dictionaries,
         app_.config().LEDGER_REPLAY,
         app_.config().TX_REDUCE_RELAY_ENABLE,
         app_.config().VP_REDUCE_RELAY_BASE_SQUELCH_ENABLE);
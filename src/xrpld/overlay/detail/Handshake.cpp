@@ -71,16 +71,54 @@ featureEnabled(
     return isFeatureValue(headers, feature, "1");
 }
 
+ZstdDictionary const*
+peerDictionary(
+    boost::beast::http::fields const& headers,
+    compression::Dictionaries const& dictionaries,
+    bool config)
+{
+    if (!config || !isFeatureValue(headers, FEATURE_COMPR, "zstd"))
+        return nullptr;
+
+    auto const ids = getFeatureValue(headers, FEATURE_ZSTD_DICT);
+    if (!ids)
+        return nullptr;
+
+    for (auto const& dictionary : dictionaries)
+    {
+        if (beast::rfc2616::token_in_list(
+                *ids, std::to_string(dictionary->id())))
+            return dictionary.get();
+    }
+
+    return nullptr;
+}
+
 std::string
 makeFeaturesRequestHeader(
     bool comprEnabled,
+    compression::Dictionaries const& dictionaries,
     bool ledgerReplayEnabled,
     bool txReduceRelayEnabled,
     bool vpReduceRelayEnabled)
 {
     std::stringstream str;
     if (comprEnabled)
-        str << FEATURE_COMPR << "=lz4" << DELIM_FEATURE;
+    {
+        str << FEATURE_COMPR << "=lz4";
+        if (!dictionaries.empty())
+        {
+            str << DELIM_VALUE << "zstd" << DELIM_FEATURE << FEATURE_ZSTD_DICT
+                << "=";
+            for (auto it = dictionaries.begin(); it != dictionaries.end(); ++it)
+            {
+                if (it != dictionaries.begin())
+                    str << DELIM_VALUE;
+                str << (*it)->id();
+            }
+        }
+        str << DELIM_FEATURE;
+    }
     if (ledgerReplayEnabled)
         str << FEATURE_LEDGER_REPLAY << "=1" << DELIM_FEATURE;
     if (txReduceRelayEnabled)
@@ -94,13 +132,21 @@ std::string
 makeFeaturesResponseHeader(
     http_request_type const& headers,
     bool comprEnabled,
+    compression::Dictionaries const& dictionaries,
     bool ledgerReplayEnabled,
     bool txReduceRelayEnabled,
     bool vpReduceRelayEnabled)
 {
     std::stringstream str;
     if (comprEnabled && isFeatureValue(headers, FEATURE_COMPR, "lz4"))
-        str << FEATURE_COMPR << "=lz4" << DELIM_FEATURE;
+    {
+        str << FEATURE_COMPR << "=lz4";
+        if (auto const dictionary =
+                peerDictionary(headers, dictionaries, comprEnabled))
+            str << DELIM_VALUE << "zstd" << DELIM_FEATURE << FEATURE_ZSTD_DICT
+                << "=" << dictionary->id();
+        str << DELIM_FEATURE;
+    }
     if (ledgerReplayEnabled && featureEnabled(headers, FEATURE_LEDGER_REPLAY))
         str << FEATURE_LEDGER_REPLAY << "=1" << DELIM_FEATURE;
     if (txReduceRelayEnabled && featureEnabled(headers, FEATURE_TXRR))
@@ -365,6 +411,7 @@ auto
 makeRequest(
     bool crawlPublic,
     bool comprEnabled,
+    compression::Dictionaries const& dictionaries,
     bool ledgerReplayEnabled,
     bool txReduceRelayEnabled,
     bool vpReduceRelayEnabled) -> request_type
@@ -382,6 +429,7 @@ makeRequest(
         "X-Protocol-Ctl",
         makeFeaturesRequestHeader(
             comprEnabled,
+            dictionaries,
             ledgerReplayEnabled,
             txReduceRelayEnabled,
             vpReduceRelayEnabled));
@@ -397,6 +445,7 @@ makeResponse(
     uint256 const& sharedValue,
     std::optional<std::uint32_t> networkID,
     ProtocolVersion protocol,
+    compression::Dictionaries const& dictionaries,
     Application& app)
 {
     http_response_type resp;
@@ -412,6 +461,7 @@ makeResponse(
         makeFeaturesResponseHeader(
             req,
             app.config().COMPRESSION,
+            dictionaries,
             app.config().LEDGER_REPLAY,
             app.config().TX_REDUCE_RELAY_ENABLE,
             app.config().VP_REDUCE_RELAY_BASE_SQUELCH_ENABLE));
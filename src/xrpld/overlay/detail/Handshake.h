@@ -21,6 +21,7 @@
 #define RIPPLE_OVERLAY_HANDSHAKE_H_INCLUDED
 
 #include <xrpld/app/main/Application.h>
+#include <xrpld/overlay/Compression.h>
 #include <xrpld/overlay/detail/ProtocolVersion.h>
 
 #include <xrpl/beast/utility/Journal.h>
@@ -94,6 +95,7 @@ verifyHandshake(
 
    @param crawlPublic if true then server's IP/Port are included in crawl
    @param comprEnabled if true then compression feature is enabled
+   @param dictionaries zstd dictionaries to offer if compression is enabled
    @param ledgerReplayEnabled if true then ledger-replay feature is enabled
    @param txReduceRelayEnabled if true then transaction reduce-relay feature is
    enabled
@@ -105,6 +107,7 @@ request_type
 makeRequest(
     bool crawlPublic,
     bool comprEnabled,
+    compression::Dictionaries const& dictionaries,
     bool ledgerReplayEnabled,
     bool txReduceRelayEnabled,
     bool vpReduceRelayEnabled);
@@ -118,6 +121,8 @@ makeRequest(
    @param sharedValue shared value based on the SSL connection state
    @param networkID specifies what network we intend to connect to
    @param version supported protocol version
+   @param dictionaries zstd dictionaries to choose from if compression is
+   enabled
    @param app Application's reference to access some common properties
    @return http response
  */
@@ -130,6 +135,7 @@ makeResponse(
     uint256 const& sharedValue,
     std::optional<std::uint32_t> networkID,
     ProtocolVersion version,
+    compression::Dictionaries const& dictionaries,
     Application& app);
 
 // Protocol features negotiated via HTTP handshake.
@@ -139,6 +145,8 @@ makeResponse(
 
 // compression feature
 static constexpr char FEATURE_COMPR[] = "compr";
+// IDs of the zstd dictionaries offered (request) or chosen (response)
+static constexpr char FEATURE_ZSTD_DICT[] = "zstddict";
 // validation/proposal reduce-relay base squelch feature
 static constexpr char FEATURE_VPRR[] = "vprr";
 // transaction reduce-relay feature
@@ -204,6 +212,20 @@ peerFeatureEnabled(
     return config && isFeatureValue(request, feature, value);
 }
 
+/** Find the zstd dictionary to compress a peer's messages with. This is
+    the newest dictionary we have whose ID is in the http header, if the
+    compression configuration is enabled and the header has the zstd value.
+   @param headers request (inbound) or response (outbound) header
+   @param dictionaries our dictionaries, newest first
+   @param config compression configuration value
+   @return the dictionary, or nullptr if zstd is not enabled
+ */
+ZstdDictionary const*
+peerDictionary(
+    boost::beast::http::fields const& headers,
+    compression::Dictionaries const& dictionaries,
+    bool config);
+
 /** Wrapper for enable(1)/disable type(0) of feature */
 template <typename headers>
 bool
@@ -217,6 +239,7 @@ peerFeatureEnabled(
 
 /** Make request header X-Protocol-Ctl value with supported features
    @param comprEnabled if true then compression feature is enabled
+   @param dictionaries zstd dictionaries to offer if compression is enabled
    @param ledgerReplayEnabled if true then ledger-replay feature is enabled
    @param txReduceRelayEnabled if true then transaction reduce-relay feature is
    enabled
@@ -227,6 +250,7 @@ peerFeatureEnabled(
 std::string
 makeFeaturesRequestHeader(
     bool comprEnabled,
+    compression::Dictionaries const& dictionaries,
     bool ledgerReplayEnabled,
     bool txReduceRelayEnabled,
     bool vpReduceRelayEnabled);
@@ -237,6 +261,8 @@ makeFeaturesRequestHeader(
     the response header.
    @param header request's header
    @param comprEnabled if true then compression feature is enabled
+   @param dictionaries zstd dictionaries to choose from if compression is
+   enabled
    @param ledgerReplayEnabled if true then ledger-replay feature is enabled
    @param txReduceRelayEnabled if true then transaction reduce-relay feature is
    enabled
@@ -248,6 +274,7 @@ std::string
 makeFeaturesResponseHeader(
     http_request_type const& headers,
     bool comprEnabled,
+    compression::Dictionaries const& dictionaries,
     bool ledgerReplayEnabled,
     bool txReduceRelayEnabled,
     bool vpReduceRelayEnabled);
@@ -135,6 +135,45 @@ Message::compress()
     }
 }
 
+void
+Message::compressZstd(
+    ZstdDictionary const& dictionary,
+    std::vector<uint8_t>& compressed)
+{
+    using namespace ripple::compression;
+    auto const messageBytes = buffer_.size() - headerBytes;
+
+    // A dictionary supplies the structure that the small messages, such as
+    // validations and proposals, share with each other, so unlike LZ4, zstd
+    // is worth trying on every type of message but the tiniest.
+    if (messageBytes <= 32)
+        return;
+
+    auto const compressedSize = ripple::compression::compress(
+        buffer_.data() + headerBytes,
+        messageBytes,
+        [&](std::size_t inSize) {  // size of required compressed buffer
+            compressed.resize(inSize + headerBytesCompressed);
+            return (compressed.data() + headerBytesCompressed);
+        },
+        Algorithm::Zstd,
+        &dictionary);
+
+    if (compressedSize != 0 &&
+        compressedSize < (messageBytes - (headerBytesCompressed - headerBytes)))
+    {
+        compressed.resize(headerBytesCompressed + compressedSize);
+        setHeader(
+            compressed.data(),
+            compressedSize,
+            getType(buffer_.data()),
+            Algorithm::Zstd,
+            messageBytes);
+    }
+    else
+        compressed.clear();
+}
+
 /** Set payload header
 
     The header is a variable-sized structure that contains information about
@@ -207,11 +246,30 @@ Message::getBufferSize()
 }
 
 std::vector<uint8_t> const&
-Message::getBuffer(Compressed tryCompressed)
+Message::getBuffer(Compressed tryCompressed, ZstdDictionary const* dictionary)
 {
     if (tryCompressed == Compressed::Off)
         return buffer_;
 
+    if (dictionary)
+    {
+        // Each buffer is written once, when it is inserted, and entries are
+        // never removed, so a published entry can be read without the lock.
+        auto entry = zstdRecent_.load(std::memory_order_acquire);
+        if (!entry || entry->first != dictionary)
+        {
+            std::lock_guard lock(zstdMutex_);
+            auto const [it, inserted] = bufferZstd_.try_emplace(dictionary);
+            if (inserted)
+                compressZstd(*dictionary, it->second);
+            entry = &*it;
+            zstdRecent_.store(entry, std::memory_order_release);
+        }
+        if (!entry->second.empty())
+            return entry->second;
+        return buffer_;
+    }
+
     std::call_once(once_flag_, &Message::compress, this);
 
     if (bufferCompressed_.size() > 0)
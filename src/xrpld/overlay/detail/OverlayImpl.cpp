@@ -42,6 +42,9 @@
 
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/asio/executor_work_guard.hpp>
+#include <boost/filesystem/operations.hpp>
+
+#include <algorithm>
 
 namespace ripple {
 
@@ -594,6 +597,12 @@ OverlayImpl::onWrite(beast::PropertyStream::Map& stream)
         item["bytes_out"] = std::to_string(pair.second.bytesOut.load());
         item["messages_out"] = std::to_string(pair.second.messagesOut.load());
     }
+
+    beast::PropertyStream::Map writes("writes", stream);
+    auto const& counts = m_traffic.getWrites();
+    writes["writes"] = std::to_string(counts.writes.load());
+    writes["messages"] = std::to_string(counts.messages.load());
+    writes["bytes"] = std::to_string(counts.bytes.load());
 }
 
 //------------------------------------------------------------------------------
@@ -702,6 +711,12 @@ OverlayImpl::reportOutboundTraffic(TrafficCount::category cat, int size)
 {
     m_traffic.addCount(cat, false, size);
 }
+
+void
+OverlayImpl::reportWrite(std::size_t messages, std::uint64_t bytes)
+{
+    m_traffic.addWrite(messages, bytes);
+}
 /** The number of active peers on the network
     Active peers are only those peers that have completed the handshake
     and are running the Ripple protocol.
@@ -1254,10 +1269,24 @@ OverlayImpl::relay(
     peers = getActivePeers(toSkip, total, disabled, enabledInSkip);
     auto const minRelay = app_.config().TX_REDUCE_RELAY_MIN_PEERS + disabled;
 
+    // Peers with the tx reduce-relay feature enabled accept TMTransactions,
+    // so the transaction is batched with others relayed to the same peer
+    // within the aggregation window.
+    std::shared_ptr<protocol::TMTransaction const> batched;
+    auto const send = [&](std::shared_ptr<Peer> const& p) {
+        if (app_.config().TX_BATCH_WINDOW == std::chrono::milliseconds{0} ||
+            !p->txReduceRelayEnabled())
+            return p->send(sm);
+
+        if (!batched)
+            batched = std::make_shared<protocol::TMTransaction const>(txn);
+        p->addTxBatch(batched);
+    };
+
     if (!app_.config().TX_REDUCE_RELAY_ENABLE || total <= minRelay)
     {
         for (auto const& p : peers)
-            p->send(sm);
+            send(p);
         if (app_.config().TX_REDUCE_RELAY_ENABLE ||
             app_.config().TX_REDUCE_RELAY_METRICS)
             txMetrics_.addMetrics(total, toSkip.size(), 0);
@@ -1291,7 +1320,7 @@ OverlayImpl::relay(
         else if (enabledAndRelayed < enabledTarget)
         {
             enabledAndRelayed++;
-            p->send(sm);
+            send(p);
         }
         else
         {
@@ -1486,6 +1515,36 @@ OverlayImpl::deleteIdlePeers()
 
 //------------------------------------------------------------------------------
 
+// Loads the dictionary to compress messages with. Peers which don't have it
+// yet may have an earlier one, so every other file with the same extension in
+// the same directory is loaded too, newest first.
+static compression::Dictionaries
+loadDictionaries(std::string const& file)
+{
+    using namespace boost::filesystem;
+
+    path const current(file);
+    compression::Dictionaries dictionaries{ZstdDictionary::load(current)};
+
+    boost::system::error_code ec;
+    for (directory_iterator it(current.parent_path(), ec), end;
+         !ec && it != end;
+         it.increment(ec))
+    {
+        auto const& p = it->path();
+        if (p.extension() != current.extension() ||
+            p.filename() == current.filename())
+            continue;
+        dictionaries.push_back(ZstdDictionary::load(p));
+    }
+
+    std::sort(
+        std::next(dictionaries.begin()),
+        dictionaries.end(),
+        [](auto const& a, auto const& b) { return a->id() > b->id(); });
+    return dictionaries;
+}
+
 Overlay::Setup
 setup_Overlay(BasicConfig const& config)
 {
@@ -1508,6 +1567,11 @@ setup_Overlay(BasicConfig const& config)
             if (ec || beast::IP::is_private(setup.public_ip))
                 Throw<std::runtime_error>("Configured public IP is invalid");
         }
+
+        std::string dictionary;
+        set(dictionary, "compression_dictionary", section);
+        if (!dictionary.empty())
+            setup.dictionaries = loadDictionaries(dictionary);
     }
 
     {
@@ -353,6 +353,15 @@ public:
     void
     reportOutboundTraffic(TrafficCount::category cat, int bytes);
 
+    void
+    reportWrite(std::size_t messages, std::uint64_t bytes);
+
+    TrafficCount::WriteStats const&
+    getWriteStats() const
+    {
+        return m_traffic.getWrites();
+    }
+
     void
     incJqTransOverflow() override
     {
@@ -593,12 +602,18 @@ private:
                 trafficGauges_)
             : peerDisconnects(
                   collector->make_gauge("Overlay", "Peer_Disconnects"))
+            , writes(collector->make_gauge("Overlay", "Writes"))
+            , writeMessages(collector->make_gauge("Overlay", "Write_Messages"))
+            , writeBytes(collector->make_gauge("Overlay", "Write_Bytes"))
             , trafficGauges(std::move(trafficGauges_))
             , hook(collector->make_hook(handler))
         {
         }
 
         beast::insight::Gauge peerDisconnects;
+        beast::insight::Gauge writes;
+        beast::insight::Gauge writeMessages;
+        beast::insight::Gauge writeBytes;
         std::unordered_map<TrafficCount::category, TrafficGauges> trafficGauges;
         beast::insight::Hook hook;
     };
@@ -635,6 +650,11 @@ private:
             gauge.messagesOut = value.messagesOut;
         }
 
+        auto const& writes = m_traffic.getWrites();
+        m_stats.writes = writes.writes;
+        m_stats.writeMessages = writes.messages;
+        m_stats.writeBytes = writes.bytes;
+
         m_stats.peerDisconnects = getPeerDisconnect();
     }
 };
@@ -114,6 +114,11 @@ PeerImp::PeerImp(
               app_.config().COMPRESSION)
               ? Compressed::On
               : Compressed::Off)
+    , dictionary_(peerDictionary(
+          headers_,
+          overlay_.setup().dictionaries,
+          compressionEnabled_ == Compressed::On))
+    , txBatchTimer_(waitable_timer{socket_.get_executor()})
     , txReduceRelayEnabled_(peerFeatureEnabled(
           headers_,
           FEATURE_TXRR,
@@ -126,6 +131,7 @@ PeerImp::PeerImp(
 {
     JLOG(journal_.info())
         << "compression enabled " << (compressionEnabled_ == Compressed::On)
+        << " zstd dictionary " << (dictionary_ ? dictionary_->id() : 0)
         << " vp reduce-relay base squelch enabled "
         << peerFeatureEnabled(
                headers_,
@@ -248,24 +254,23 @@ PeerImp::send(std::shared_ptr<Message> const& m)
     if (shutdown_)
         return tryAsyncShutdown();
 
+    auto const bytes =
+        static_cast<int>(m->getBuffer(compressionEnabled_, dictionary_).size());
+
     auto validator = m->getValidatorKey();
     if (validator && !squelch_.expireSquelch(*validator))
     {
         overlay_.reportOutboundTraffic(
-            TrafficCount::category::squelch_suppressed,
-            static_cast<int>(m->getBuffer(compressionEnabled_).size()));
+            TrafficCount::category::squelch_suppressed, bytes);
         return;
     }
 
     // report categorized outgoing traffic
     overlay_.reportOutboundTraffic(
-        safe_cast<TrafficCount::category>(m->getCategory()),
-        static_cast<int>(m->getBuffer(compressionEnabled_).size()));
+        safe_cast<TrafficCount::category>(m->getCategory()), bytes);
 
     // report total outgoing traffic
-    overlay_.reportOutboundTraffic(
-        TrafficCount::category::total,
-        static_cast<int>(m->getBuffer(compressionEnabled_).size()));
+    overlay_.reportOutboundTraffic(TrafficCount::category::total, bytes);
 
     auto sendq_size = send_queue_.size();
 
@@ -284,23 +289,12 @@ PeerImp::send(std::shared_ptr<Message> const& m)
              << " sendq: " << sendq_size;
     }
 
-    send_queue_.push(m);
+    send_queue_.push_back(m);
 
     if (sendq_size != 0)
         return;
 
-    writePending_ = true;
-    boost::asio::async_write(
-        stream_,
-        boost::asio::buffer(
-            send_queue_.front()->getBuffer(compressionEnabled_)),
-        bind_executor(
-            strand_,
-            std::bind(
-                &PeerImp::onWriteMessage,
-                shared_from_this(),
-                std::placeholders::_1,
-                std::placeholders::_2)));
+    writeMessages();
 }
 
 void
@@ -351,6 +345,100 @@ PeerImp::removeTxQueue(uint256 const& hash)
     JLOG(p_journal_.trace()) << "removeTxQueue " << removed;
 }
 
+void
+PeerImp::addTxBatch(std::shared_ptr<protocol::TMTransaction const> const& tx)
+{
+    if (!strand_.running_in_this_thread())
+        return post(
+            strand_,
+            std::bind(&PeerImp::addTxBatch, shared_from_this(), tx));
+
+    txBatch_.emplace_back(tx, clock_type::now());
+
+    if (txBatch_.size() >= reduce_relay::MAX_TX_BATCH_SIZE)
+        return sendTxBatch();
+
+    // The window starts with the first transaction of the batch
+    if (txBatch_.size() != 1)
+        return;
+
+    try
+    {
+        txBatchTimer_.expires_after(app_.config().TX_BATCH_WINDOW);
+    }
+    catch (std::exception const& ex)
+    {
+        JLOG(journal_.error()) << "addTxBatch: " << ex.what();
+        return sendTxBatch();
+    }
+
+    txBatchTimer_.async_wait(bind_executor(
+        strand_,
+        std::bind(
+            &PeerImp::onTxBatchTimer,
+            shared_from_this(),
+            std::placeholders::_1)));
+}
+
+void
+PeerImp::onTxBatchTimer(error_code const& ec)
+{
+    XRPL_ASSERT(
+        strand_.running_in_this_thread(),
+        "ripple::PeerImp::onTxBatchTimer : strand in this thread");
+
+    if (!socket_.is_open() || ec == boost::asio::error::operation_aborted)
+        return;
+
+    if (ec)
+        JLOG(journal_.error()) << "onTxBatchTimer: " << ec.message();
+
+    sendTxBatch();
+}
+
+void
+PeerImp::sendTxBatch()
+{
+    XRPL_ASSERT(
+        strand_.running_in_this_thread(),
+        "ripple::PeerImp::sendTxBatch : strand in this thread");
+
+    if (txBatch_.empty())
+        return;
+
+    if (app_.config().TX_REDUCE_RELAY_ENABLE ||
+        app_.config().TX_REDUCE_RELAY_METRICS)
+    {
+        auto const now = clock_type::now();
+        clock_type::duration delay{0};
+        for (auto const& [_, added] : txBatch_)
+            delay += now - added;
+
+        overlay_.addTxMetrics(
+            static_cast<std::uint32_t>(txBatch_.size()),
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                delay / txBatch_.size()));
+    }
+
+    JLOG(p_journal_.trace()) << "sendTxBatch " << txBatch_.size();
+
+    // A single transaction is sent as it would be without the batch
+    if (txBatch_.size() == 1)
+    {
+        send(std::make_shared<Message>(
+            *txBatch_.front().first, protocol::mtTRANSACTION));
+    }
+    else
+    {
+        protocol::TMTransactions batch;
+        for (auto const& [tx, _] : txBatch_)
+            *batch.add_transactions() = *tx;
+        send(std::make_shared<Message>(batch, protocol::mtTRANSACTIONS));
+    }
+
+    txBatch_.clear();
+}
+
 void
 PeerImp::charge(Resource::Charge const& fee, std::string const& context)
 {
@@ -502,6 +590,8 @@ PeerImp::json()
         std::to_string(metrics_.recv.average_bytes());
     ret[jss::metrics][jss::avg_bps_sent] =
         std::to_string(metrics_.sent.average_bytes());
+    ret[jss::metrics][jss::total_writes] =
+        std::to_string(metrics_.sent.total_count());
 
     return ret;
 }
@@ -803,6 +893,7 @@ PeerImp::cancelTimer() noexcept
     try
     {
         timer_.cancel();
+        txBatchTimer_.cancel();
     }
     catch (std::exception const& ex)
     {
@@ -868,6 +959,7 @@ PeerImp::doAccept()
         *sharedValue,
         overlay_.setup().networkID,
         protocol_,
+        overlay_.setup().dictionaries,
         app_);
 
     // Write the whole buffer and only start protocol when that's done.
@@ -1041,6 +1133,38 @@ PeerImp::onReadMessage(error_code ec, std::size_t bytes_transferred)
                 std::placeholders::_2)));
 }
 
+void
+PeerImp::writeMessages()
+{
+    XRPL_ASSERT(
+        strand_.running_in_this_thread(),
+        "ripple::PeerImp::writeMessages : strand in this thread");
+    XRPL_ASSERT(
+        !send_queue_.empty() && write_buffers_.empty(),
+        "ripple::PeerImp::writeMessages : messages to write");
+
+    // The buffers are owned by the messages, which stay in the queue until
+    // the write completes, so the write does not copy them.
+    auto const count =
+        std::min<std::size_t>(send_queue_.size(), Tuning::maxWriteMessages);
+    write_buffers_.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        write_buffers_.push_back(boost::asio::buffer(
+            send_queue_[i]->getBuffer(compressionEnabled_, dictionary_)));
+
+    writePending_ = true;
+    boost::asio::async_write(
+        stream_,
+        write_buffers_,
+        bind_executor(
+            strand_,
+            std::bind(
+                &PeerImp::onWriteMessage,
+                shared_from_this(),
+                std::placeholders::_1,
+                std::placeholders::_2)));
+}
+
 void
 PeerImp::onWriteMessage(error_code ec, std::size_t bytes_transferred)
 {
@@ -1070,34 +1194,25 @@ PeerImp::onWriteMessage(error_code ec, std::size_t bytes_transferred)
     }
 
     metrics_.sent.add_message(bytes_transferred);
+    overlay_.reportWrite(write_buffers_.size(), bytes_transferred);
 
     XRPL_ASSERT(
-        !send_queue_.empty(),
-        "ripple::PeerImp::onWriteMessage : non-empty send buffer");
-    send_queue_.pop();
+        send_queue_.size() >= write_buffers_.size(),
+        "ripple::PeerImp::onWriteMessage : written messages are queued");
+    send_queue_.erase(
+        send_queue_.begin(), send_queue_.begin() + write_buffers_.size());
+    write_buffers_.clear();
 
     if (shutdown_)
         return tryAsyncShutdown();
 
     if (!send_queue_.empty())
     {
-        writePending_ = true;
         XRPL_ASSERT(
             !shutdownStarted_,
             "ripple::PeerImp::onWriteMessage : shutdown started");
 
-        // Timeout on writes only
-        return boost::asio::async_write(
-            stream_,
-            boost::asio::buffer(
-                send_queue_.front()->getBuffer(compressionEnabled_)),
-            bind_executor(
-                strand_,
-                std::bind(
-                    &PeerImp::onWriteMessage,
-                    shared_from_this(),
-                    std::placeholders::_1,
-                    std::placeholders::_2)));
+        writeMessages();
     }
 }
 
@@ -1354,20 +1469,16 @@ PeerImp::onMessage(std::shared_ptr<protocol::TMEndpoints> const& m)
 void
 PeerImp::onMessage(std::shared_ptr<protocol::TMTransaction> const& m)
 {
-    handleTransaction(m, true, false);
+    handleTransaction(m, false);
 }
 
-void
+bool
 PeerImp::handleTransaction(
     std::shared_ptr<protocol::TMTransaction> const& m,
-    bool eraseTxQueue,
     bool batch)
 {
-    XRPL_ASSERT(
-        eraseTxQueue != batch,
-        ("ripple::PeerImp::handleTransaction : valid inputs"));
     if (tracking_.load() == Tracking::diverged)
-        return;
+        return false;
 
     if (app_.getOPs().isNeedNetworkLedger())
     {
@@ -1375,7 +1486,7 @@ PeerImp::handleTransaction(
         // with a transaction
         JLOG(p_journal_.debug()) << "Ignoring incoming transaction: "
                                  << "Need network ledger";
-        return;
+        return false;
     }
 
     SerialIter sit(makeSlice(m->rawtransaction()));
@@ -1385,6 +1496,10 @@ PeerImp::handleTransaction(
         auto stx = std::make_shared<STTx const>(sit);
         uint256 txID = stx->getTransactionID();
 
+        // A peer also relays batches in TMTransactions, so only the
+        // transactions requested from it are answers to the request.
+        batch = batch && takeRequestedTx(txID);
+
         // Charge strongly for attempting to relay a txn with tfInnerBatchTxn
         // LCOV_EXCL_START
         /*
@@ -1408,7 +1523,7 @@ PeerImp::handleTransaction(
             JLOG(p_journal_.warn()) << "Ignoring Network relayed Tx containing "
                                        "tfInnerBatchTxn (handleTransaction).";
             fee_.update(Resource::feeModerateBurdenPeer, "inner batch txn");
-            return;
+            return batch;
         }
         // LCOV_EXCL_STOP
 
@@ -1426,14 +1541,14 @@ PeerImp::handleTransaction(
 
             // Erase only if the server has seen this tx. If the server has not
             // seen this tx then the tx could not has been queued for this peer.
-            else if (eraseTxQueue && txReduceRelayEnabled())
+            else if (txReduceRelayEnabled())
                 removeTxQueue(txID);
 
             overlay_.reportInboundTraffic(
                 TrafficCount::category::transaction_duplicate,
                 Message::messageSize(*m));
 
-            return;
+            return batch;
         }
 
         JLOG(p_journal_.debug()) << "Got tx " << txID;
@@ -1485,6 +1600,7 @@ PeerImp::handleTransaction(
                             flags, checkSignature, stx, batch);
                 });
         }
+        return batch;
     }
     catch (std::exception const& ex)
     {
@@ -1492,6 +1608,14 @@ PeerImp::handleTransaction(
             << "Transaction invalid: " << strHex(m->rawtransaction())
             << ". Exception: " << ex.what();
     }
+    return false;
+}
+
+bool
+PeerImp::takeRequestedTx(uint256 const& hash)
+{
+    std::lock_guard lock(requestedTxMutex_);
+    return requestedTx_.erase(hash) != 0;
 }
 
 void
@@ -2782,8 +2906,24 @@ PeerImp::handleHaveTransactions(
     JLOG(p_journal_.trace())
         << "transaction request object is " << tmBH.objects_size();
 
-    if (tmBH.objects_size() > 0)
-        send(std::make_shared<Message>(tmBH, protocol::mtGET_OBJECTS));
+    if (tmBH.objects_size() == 0)
+        return;
+
+    {
+        std::lock_guard lock(requestedTxMutex_);
+        // The peer may never send some of them, so don't let them pile up
+        if (requestedTx_.size() + tmBH.objects_size() >
+            reduce_relay::MAX_TX_QUEUE_SIZE)
+        {
+            JLOG(p_journal_.debug())
+                << "requested transactions exceed the cap";
+            requestedTx_.clear();
+        }
+        for (auto const& obj : tmBH.objects())
+            requestedTx_.insert(uint256::fromVoid(obj.hash().data()));
+    }
+
+    send(std::make_shared<Message>(tmBH, protocol::mtGET_OBJECTS));
 }
 
 void
@@ -2800,14 +2940,21 @@ PeerImp::onMessage(std::shared_ptr<protocol::TMTransactions> const& m)
     JLOG(p_journal_.trace())
         << "received TMTransactions " << m->transactions_size();
 
-    overlay_.addTxMetrics(m->transactions_size());
-
+    // Only the transactions requested from the peer count as missing; the
+    // rest were relayed in a batch.
+    std::uint32_t requested = 0;
     for (std::uint32_t i = 0; i < m->transactions_size(); ++i)
-        handleTransaction(
-            std::shared_ptr<protocol::TMTransaction>(
-                m->mutable_transactions(i), [](protocol::TMTransaction*) {}),
-            false,
-            true);
+    {
+        if (handleTransaction(
+                std::shared_ptr<protocol::TMTransaction>(
+                    m->mutable_transactions(i),
+                    [](protocol::TMTransaction*) {}),
+                true))
+            ++requested;
+    }
+
+    if (requested != 0)
+        overlay_.addTxMetrics(requested);
 }
 
 void
@@ -3655,6 +3802,7 @@ PeerImp::Metrics::add_message(std::uint64_t bytes)
     using namespace std::chrono_literals;
     std::unique_lock lock{mutex_};
 
+    ++totalCount_;
     totalBytes_ += bytes;
     accumBytes_ += bytes;
     auto const timeElapsed = clock_type::now() - intervalStart_;
@@ -3689,4 +3837,11 @@ PeerImp::Metrics::total_bytes() const
     return totalBytes_;
 }
 
+std::uint64_t
+PeerImp::Metrics::total_count() const
+{
+    std::shared_lock lock{mutex_};
+    return totalCount_;
+}
+
 }  // namespace ripple
@@ -42,8 +42,8 @@
 
 #include <atomic>
 #include <cstdint>
+#include <deque>
 #include <optional>
-#include <queue>
 
 namespace ripple {
 
@@ -89,6 +89,7 @@ class SHAMap;
  * - If shutdown initiated during processing, calls `tryAsyncShutdown()`
  *
  * **Write Operations (`onWriteMessage`)**:
+ * - Each write gathers the messages queued when it starts
  * - Checks `shutdown_` flag before queuing new writes
  * - Calls `tryAsyncShutdown()` when shutdown flag detected
  *
@@ -238,7 +239,10 @@ private:
     http_request_type request_;
     http_response_type response_;
     boost::beast::http::fields const& headers_;
-    std::queue<std::shared_ptr<Message>> send_queue_;
+    std::deque<std::shared_ptr<Message>> send_queue_;
+    // The buffers of the messages at the front of send_queue_ being written.
+    // They point into the messages, which are immutable once serialized.
+    std::vector<boost::asio::const_buffer> write_buffers_;
 
     // Primary shutdown flag set when shutdown is requested
     bool shutdown_ = false;
@@ -259,11 +263,26 @@ private:
     hash_map<PublicKey, std::size_t> publisherListSequences_;
 
     Compressed compressionEnabled_ = Compressed::Off;
+    // The zstd dictionary to compress messages with, if agreed with the peer
+    ZstdDictionary const* dictionary_ = nullptr;
 
     // Queue of transactions' hashes that have not been
     // relayed. The hashes are sent once a second to a peer
     // and the peer requests missing transactions from the node.
     hash_set<uint256> txQueue_;
+    // Transactions relayed to the peer within the aggregation window, with
+    // the time each was added. They are sent in one TMTransactions when the
+    // window has passed.
+    std::vector<std::pair<
+        std::shared_ptr<protocol::TMTransaction const>,
+        clock_type::time_point>>
+        txBatch_;
+    waitable_timer txBatchTimer_;
+    // Transactions requested from the peer, after it announced them, which
+    // it has not sent yet. Only these are answers to the request when they
+    // arrive in a TMTransactions, since the peer also relays batches in it.
+    std::mutex requestedTxMutex_;
+    hash_set<uint256> requestedTx_;
     // true if tx reduce-relay feature is enabled on the peer.
     bool txReduceRelayEnabled_ = false;
 
@@ -289,12 +308,16 @@ private:
         average_bytes() const;
         std::uint64_t
         total_bytes() const;
+        // The number of reads or writes
+        std::uint64_t
+        total_count() const;
 
     private:
         std::shared_mutex mutable mutex_;
         boost::circular_buffer<std::uint64_t> rollingAvg_{30, 0ull};
         clock_type::time_point intervalStart_{clock_type::now()};
         std::uint64_t totalBytes_{0};
+        std::uint64_t totalCount_{0};
         std::uint64_t accumBytes_{0};
         std::uint64_t rollingAvgBytes_{0};
     };
@@ -382,6 +405,18 @@ public:
     void
     removeTxQueue(uint256 const& hash) override;
 
+    /** Add relayed transaction to the batch sent once the aggregation
+       window has passed
+       @param tx transaction's protocol message
+     */
+    void
+    addTxBatch(std::shared_ptr<protocol::TMTransaction const> const& tx)
+        override;
+
+    /** Send the batch of relayed transactions */
+    void
+    sendTxBatch();
+
     /** Send a set of PeerFinder endpoints as a protocol message. */
     template <
         class FwdIt,
@@ -507,6 +542,13 @@ public:
         return compressionEnabled_ == Compressed::On;
     }
 
+    /** The zstd dictionary for messages to and from the peer, if any. */
+    ZstdDictionary const*
+    compressionDictionary() const
+    {
+        return dictionary_;
+    }
+
     bool
     txReduceRelayEnabled() const override
     {
@@ -658,28 +700,42 @@ private:
     void
     onReadMessage(error_code ec, std::size_t bytes_transferred);
 
+    // Write the messages at the front of the send queue, with one gathering
+    // write so the socket can send them together.
+    void
+    writeMessages();
+
+    // Called when the aggregation window of the transaction batch has passed
+    void
+    onTxBatchTimer(error_code const& ec);
+
     // Called when protocol messages bytes are sent
     void
     onWriteMessage(error_code ec, std::size_t bytes_transferred);
 
     /** Called from onMessage(TMTransaction(s)).
+       If the server has seen the transaction, its hash is erased from
+       txQueue_, so it isn't announced back to the peer. TMTransactions may
+       be a batch the peer relayed, not only a response to the missing
+       transactions request, so this applies to both messages.
        @param m Transaction protocol message
-       @param eraseTxQueue is true when called from onMessage(TMTransaction)
-       and is false when called from onMessage(TMTransactions). If true then
-       the transaction hash is erased from txQueue_. Don't need to erase from
-       the queue when called from onMessage(TMTransactions) because this
-       message is a response to the missing transactions request and the queue
-       would not have any of these transactions.
        @param batch is false when called from onMessage(TMTransaction)
-       and is true when called from onMessage(TMTransactions). If true, then the
-       transaction is part of a batch, and should not be charged an extra fee.
+       and is true when called from onMessage(TMTransactions). Only a
+       transaction in a batch which was requested from the peer is not
+       charged an extra fee.
+       @return true if the transaction was requested from the peer
      */
-    void
+    bool
     handleTransaction(
         std::shared_ptr<protocol::TMTransaction> const& m,
-        bool eraseTxQueue,
         bool batch);
 
+    /** Forget a transaction requested from the peer.
+       @return true if it had been requested
+     */
+    bool
+    takeRequestedTx(uint256 const& hash);
+
     /** Handle protocol message with hashes of transactions that have not
        been relayed by an upstream node down to its peers - request
        transactions, which have not been relayed to this peer.
@@ -864,6 +920,11 @@ PeerImp::PeerImp(
               app_.config().COMPRESSION)
               ? Compressed::On
               : Compressed::Off)
+    , dictionary_(peerDictionary(
+          headers_,
+          overlay_.setup().dictionaries,
+          compressionEnabled_ == Compressed::On))
+    , txBatchTimer_(waitable_timer{socket_.get_executor()})
     , txReduceRelayEnabled_(peerFeatureEnabled(
           headers_,
           FEATURE_TXRR,
@@ -878,6 +939,7 @@ PeerImp::PeerImp(
         read_buffer_.prepare(boost::asio::buffer_size(buffers)), buffers));
     JLOG(journal_.info())
         << "compression enabled " << (compressionEnabled_ == Compressed::On)
+        << " zstd dictionary " << (dictionary_ ? dictionary_->id() : 0)
         << " vp reduce-relay base squelch enabled "
         << peerFeatureEnabled(
                headers_,
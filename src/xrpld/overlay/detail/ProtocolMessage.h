@@ -133,8 +133,7 @@ struct MessageHeader
     std::uint16_t message_type = 0;
 
     /** Indicates which compression algorithm the payload is compressed with.
-     * Currenly only lz4 is supported. If None then the message is not
-     * compressed.
+     * If None then the message is not compressed.
      */
     compression::Algorithm algorithm = compression::Algorithm::None;
 };
@@ -203,7 +202,8 @@ parseMessageHeader(
 
         hdr.algorithm = static_cast<compression::Algorithm>(*iter & 0xF0);
 
-        if (hdr.algorithm != compression::Algorithm::LZ4)
+        if (hdr.algorithm != compression::Algorithm::LZ4 &&
+            hdr.algorithm != compression::Algorithm::Zstd)
         {
             ec = make_error_code(boost::system::errc::protocol_error);
             return std::nullopt;
@@ -263,7 +263,10 @@ template <
     class = std::enable_if_t<
         std::is_base_of<::google::protobuf::Message, T>::value>>
 std::shared_ptr<T>
-parseMessageContent(MessageHeader const& header, Buffers const& buffers)
+parseMessageContent(
+    MessageHeader const& header,
+    Buffers const& buffers,
+    ZstdDictionary const* dictionary = nullptr)
 {
     auto const m = std::make_shared<T>();
 
@@ -280,7 +283,8 @@ parseMessageContent(MessageHeader const& header, Buffers const& buffers)
             header.payload_wire_size,
             payload.data(),
             header.uncompressed_size,
-            header.algorithm);
+            header.algorithm,
+            dictionary);
 
         if (payloadSize == 0 || !m->ParseFromArray(payload.data(), payloadSize))
             return {};
@@ -300,7 +304,8 @@ template <
 bool
 invoke(MessageHeader const& header, Buffers const& buffers, Handler& handler)
 {
-    auto const m = parseMessageContent<T>(header, buffers);
+    auto const m = parseMessageContent<T>(
+        header, buffers, handler.compressionDictionary());
     if (!m)
         return false;
 
@@ -374,6 +379,14 @@ invokeProtocolMessage(
         return result;
     }
 
+    // We didn't agree on a dictionary with the peer but received zstd.
+    if (!handler.compressionDictionary() &&
+        header->algorithm == compression::Algorithm::Zstd)
+    {
+        result.second = make_error_code(boost::system::errc::protocol_error);
+        return result;
+    }
+
     // We don't have the whole message yet. This isn't an error but we have
     // nothing to do.
     if (header->total_wire_size > size)
@@ -81,6 +81,19 @@ public:
         }
     };
 
+    /** Counts the writes to peer sockets.
+
+        A peer gathers the messages in its send queue into one write, so the
+        messages and bytes per write show how well the writes are batched.
+    */
+    class WriteStats
+    {
+    public:
+        std::atomic<std::uint64_t> writes{0};
+        std::atomic<std::uint64_t> messages{0};
+        std::atomic<std::uint64_t> bytes{0};
+    };
+
     // If you add entries to this enum, you need to update the initialization
     // of the arrays at the bottom of this file which map array numbers to
     // human-readable, monitoring-tool friendly names.
@@ -235,6 +248,15 @@ public:
         }
     }
 
+    /** Account for one write of messages to a peer */
+    void
+    addWrite(std::size_t messages, std::uint64_t bytes)
+    {
+        ++writes_.writes;
+        writes_.messages += messages;
+        writes_.bytes += bytes;
+    }
+
     /** An up-to-date copy of all the counters
 
         @return an object which satisfies the requirements of Container
@@ -245,6 +267,12 @@ public:
         return counts_;
     }
 
+    WriteStats const&
+    getWrites() const
+    {
+        return writes_;
+    }
+
     static std::string
     to_string(category cat)
     {
@@ -372,6 +400,8 @@ protected:
         {total, {total}},
         {unknown, {unknown}},
     };
+
+    WriteStats writes_;
 };
 
 }  // namespace ripple
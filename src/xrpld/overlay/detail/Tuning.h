@@ -54,6 +54,9 @@ enum {
     /** How often to log send queue size */
     sendQueueLogFreq = 64,
 
+    /** The most queued messages to gather into one write */
+    maxWriteMessages = 64,
+
     /** How often we check for idle peers (seconds) */
     checkIdlePeers = 4,
 
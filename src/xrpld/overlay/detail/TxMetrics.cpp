@@ -76,6 +76,14 @@ TxMetrics::addMetrics(std::uint32_t missing)
     missingTx.addMetrics(missing);
 }
 
+void
+TxMetrics::addMetrics(std::uint32_t size, std::chrono::microseconds delay)
+{
+    std::lock_guard lock(mutex);
+    batchSize.addMetrics(size);
+    batchDelay.addMetrics(static_cast<std::uint32_t>(delay.count()));
+}
+
 void
 MultipleMetrics::addMetrics(std::uint32_t val2)
 {
@@ -144,6 +152,10 @@ TxMetrics::json() const
 
     ret[jss::txr_missing_tx_freq] = std::to_string(missingTx.rollingAvg);
 
+    ret[jss::txr_batch_sz] = std::to_string(batchSize.rollingAvg);
+
+    ret[jss::txr_batch_delay_us] = std::to_string(batchDelay.rollingAvg);
+
     return ret;
 }
 
@@ -106,6 +106,10 @@ struct TxMetrics
     SingleMetrics notEnabled{false};
     // TMTransactions number of transactions count per second
     SingleMetrics missingTx;
+    // Relayed transactions in each batch sample average
+    SingleMetrics batchSize{false};
+    // Microseconds a relayed transaction waits in its batch sample average
+    SingleMetrics batchDelay{false};
     /** Add protocol message metrics
        @param type protocol message type
        @param val message size in bytes
@@ -127,6 +131,13 @@ struct TxMetrics
      */
     void
     addMetrics(std::uint32_t missing);
+    /** Add the size of a batch of relayed transactions and the latency
+       the batch added to them.
+       @param size number of transactions in the batch
+       @param delay average time the transactions waited in the batch
+     */
+    void
+    addMetrics(std::uint32_t size, std::chrono::microseconds delay);
     /** Get json representation of the metrics
        @return json object
      */
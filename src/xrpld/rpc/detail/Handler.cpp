@@ -133,6 +133,10 @@ Handler const handlerArray[]{
     {"ledger_entry", byRef(&doLedgerEntry), Role::USER, NO_CONDITION},
     {"ledger_header", byRef(&doLedgerHeader), Role::USER, NO_CONDITION, 1, 1},
     {"ledger_request", byRef(&doLedgerRequest), Role::ADMIN, NO_CONDITION},
+    {"ledger_snapshot", byRef(&doLedgerSnapshot), Role::ADMIN, NO_CONDITION},
+    {"loan_broker_info", byRef(&doLoanBrokerInfo), Role::USER, NO_CONDITION},
+    {"loan_info", byRef(&doLoanInfo), Role::USER, NO_CONDITION},
+    {"loans_due", byRef(&doLoansDue), Role::USER, NO_CONDITION},
     {"log_level", byRef(&doLogLevel), Role::ADMIN, NO_CONDITION},
     {"logrotate", byRef(&doLogRotate), Role::ADMIN, NO_CONDITION},
     {"manifest", byRef(&doManifest), Role::USER, NO_CONDITION},
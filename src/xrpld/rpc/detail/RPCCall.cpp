@@ -879,6 +879,50 @@ private:
         return jvRequest;
     }
 
+    // loan_info <loan_id> [<ledger>]
+    // loan_broker_info <loan_broker_id> [<ledger>]
+    template <Json::StaticString const& field>
+    Json::Value
+    parseLendingObject(Json::Value const& jvParams)
+    {
+        std::string strID = jvParams[0u].asString();
+        uint256 id = beast::zero;
+        if (!id.parseHex(strID))
+            return rpcError(rpcINVALID_PARAMS);
+
+        Json::Value jvRequest(Json::objectValue);
+        jvRequest[field] = strID;
+
+        if (jvParams.size() > 1)
+            jvParseLedger(jvRequest, jvParams[1u].asString());
+
+        return jvRequest;
+    }
+
+    // loans_due <loan_broker_id> [<due_before>]
+    Json::Value
+    parseLoansDue(Json::Value const& jvParams)
+    {
+        std::string strID = jvParams[0u].asString();
+        uint256 id = beast::zero;
+        if (!id.parseHex(strID))
+            return rpcError(rpcINVALID_PARAMS);
+
+        Json::Value jvRequest(Json::objectValue);
+        jvRequest[jss::loan_broker_id] = strID;
+
+        if (jvParams.size() > 1)
+        {
+            std::uint32_t dueBefore;
+            if (!beast::lexicalCastChecked(
+                    dueBefore, jvParams[1u].asString()))
+                return rpcError(rpcINVALID_PARAMS);
+            jvRequest[jss::due_before] = dueBefore;
+        }
+
+        return jvRequest;
+    }
+
     // peer_reservations_add <public_key> [<name>]
     Json::Value
     parsePeerReservationsAdd(Json::Value const& jvParams)
@@ -1259,6 +1303,12 @@ public:
             {"ledger_entry", &RPCParser::parseLedgerEntry, 1, 2},
             {"ledger_header", &RPCParser::parseLedgerId, 1, 1},
             {"ledger_request", &RPCParser::parseLedgerId, 1, 1},
+            {"loan_broker_info",
+             &RPCParser::parseLendingObject<jss::loan_broker_id>,
+             1,
+             2},
+            {"loan_info", &RPCParser::parseLendingObject<jss::loan_id>, 1, 2},
+            {"loans_due", &RPCParser::parseLoansDue, 1, 2},
             {"log_level", &RPCParser::parseLogLevel, 0, 2},
             {"logrotate", &RPCParser::parseAsIs, 0, 0},
             {"manifest", &RPCParser::parseManifest, 1, 1},
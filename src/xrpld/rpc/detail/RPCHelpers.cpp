@@ -18,6 +18,7 @@
 //==============================================================================
 
 #include <xrpld/app/ledger/LedgerMaster.h>
+#include <xrpld/app/ledger/LedgerSnapshots.h>
 #include <xrpld/app/ledger/LedgerToJson.h>
 #include <xrpld/app/ledger/OpenLedger.h>
 #include <xrpld/app/misc/Transaction.h>
@@ -490,7 +491,10 @@ template <class T>
 Status
 getLedger(T& ledger, uint256 const& ledgerHash, Context& context)
 {
-    ledger = context.ledgerMaster.getLedgerByHash(ledgerHash);
+    // A pinned ledger is read from its snapshot, bypassing the node store
+    ledger = context.app.getLedgerSnapshots().getLedgerByHash(ledgerHash);
+    if (ledger == nullptr)
+        ledger = context.ledgerMaster.getLedgerByHash(ledgerHash);
     if (ledger == nullptr)
         return {rpcLGR_NOT_FOUND, "ledgerNotFound"};
     return Status::OK;
@@ -500,7 +504,10 @@ template <class T>
 Status
 getLedger(T& ledger, uint32_t ledgerIndex, Context& context)
 {
-    ledger = context.ledgerMaster.getLedgerBySeq(ledgerIndex);
+    // A pinned ledger is read from its snapshot, bypassing the node store
+    ledger = context.app.getLedgerSnapshots().getLedgerBySeq(ledgerIndex);
+    if (ledger == nullptr)
+        ledger = context.ledgerMaster.getLedgerBySeq(ledgerIndex);
     if (ledger == nullptr)
     {
         auto cur = context.ledgerMaster.getCurrentLedger();
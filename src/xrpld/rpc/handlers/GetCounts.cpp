@@ -25,6 +25,7 @@
 #include <xrpld/app/rdb/backend/SQLiteDatabase.h>
 #include <xrpld/nodestore/Database.h>
 #include <xrpld/rpc/Context.h>
+#include <xrpld/shamap/SHAMapInnerNode.h>
 
 #include <xrpl/basics/UptimeClock.h>
 #include <xrpl/json/json_value.h>
@@ -116,6 +117,14 @@ getCountsJson(Application& app, int minObjectCount)
     ret[jss::treenode_track_size] =
         app.getNodeFamily().getTreeNodeCache()->getTrackSize();
 
+    {
+        auto const arena = SHAMapInnerNode::getArenaCounts();
+        ret[jss::innernode_arena_size] = std::to_string(arena.reserved);
+        ret[jss::innernode_arena_used] = std::to_string(arena.used);
+        ret[jss::innernode_allocs] = std::to_string(arena.allocations);
+        ret[jss::innernode_frees] = std::to_string(arena.deallocations);
+    }
+
     std::string uptime;
     auto s = UptimeClock::now();
     using namespace std::chrono_literals;
@@ -89,6 +89,14 @@ doLedgerHeader(RPC::JsonContext&);
 Json::Value
 doLedgerRequest(RPC::JsonContext&);
 Json::Value
+doLedgerSnapshot(RPC::JsonContext&);
+Json::Value
+doLoanBrokerInfo(RPC::JsonContext&);
+Json::Value
+doLoanInfo(RPC::JsonContext&);
+Json::Value
+doLoansDue(RPC::JsonContext&);
+Json::Value
 doLogLevel(RPC::JsonContext&);
 Json::Value
 doLogRotate(RPC::JsonContext&);
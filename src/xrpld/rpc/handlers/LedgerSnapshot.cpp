@@ -0,0 +1,85 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <xrpld/app/ledger/Ledger.h>
+#include <xrpld/app/ledger/LedgerSnapshots.h>
+#include <xrpld/app/main/Application.h>
+#include <xrpld/rpc/Context.h>
+#include <xrpld/rpc/detail/RPCHelpers.h>
+
+#include <xrpl/basics/Log.h>
+#include <xrpl/protocol/ErrorCodes.h>
+#include <xrpl/protocol/RPCErr.h>
+#include <xrpl/protocol/jss.h>
+
+namespace ripple {
+
+/** Writes a snapshot of a validated ledger in the background and pins it.
+    {
+      ledger_hash : <ledger>         // optional
+      ledger_index : <ledger_index>  // optional, defaults to "validated"
+    }
+
+    Queries against the ledger are then served from the snapshot, without
+    reading the node store. The response doesn't wait for the snapshot:
+    "snapshot" is "exporting" while it is written and "pinned" once it is
+    done, so the command can be repeated to follow its progress.
+*/
+Json::Value
+doLedgerSnapshot(RPC::JsonContext& context)
+{
+    auto& snapshots = context.app.getLedgerSnapshots();
+    if (!snapshots.enabled())
+        return rpcError(rpcNOT_ENABLED);
+
+    if (!context.params.isMember(jss::ledger_hash) &&
+        !context.params.isMember(jss::ledger_index))
+        context.params[jss::ledger_index] = jss::validated;
+
+    std::shared_ptr<ReadView const> view;
+    auto result = RPC::lookupLedger(view, context);
+    if (!view)
+        return result;
+
+    // Only a validated ledger can never change, so only it can be pinned
+    auto const ledger = std::dynamic_pointer_cast<Ledger const>(view);
+    if (!ledger || !result[jss::validated].asBool())
+        return rpcError(rpcLGR_NOT_VALIDATED);
+
+    auto const status = snapshots.exportLedger(ledger);
+    switch (status.state)
+    {
+        case LedgerSnapshots::ExportState::running:
+            result[jss::snapshot] = "exporting";
+            break;
+        case LedgerSnapshots::ExportState::pinned:
+            result[jss::snapshot] = "pinned";
+            result[jss::nodes] = static_cast<Json::UInt>(status.nodes);
+            break;
+        case LedgerSnapshots::ExportState::failed:
+            JLOG(context.j.warn()) << "Snapshot of ledger "
+                                   << ledger->info().seq
+                                   << " failed: " << status.error;
+            return RPC::make_error(rpcINTERNAL, status.error);
+    }
+
+    return result;
+}
+
+}  // namespace ripple
@@ -0,0 +1,330 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <xrpld/app/misc/LendingHelpers.h>
+#include <xrpld/rpc/Context.h>
+#include <xrpld/rpc/detail/RPCHelpers.h>
+
+#include <xrpl/basics/UnorderedContainers.h>
+#include <xrpl/beast/utility/Zero.h>
+#include <xrpl/json/json_value.h>
+#include <xrpl/protocol/ErrorCodes.h>
+#include <xrpl/protocol/Indexes.h>
+#include <xrpl/protocol/Rules.h>
+#include <xrpl/protocol/STAmount.h>
+#include <xrpl/protocol/jss.h>
+
+#include <map>
+#include <mutex>
+
+namespace ripple {
+
+namespace {
+
+/** Remembers loan_info and loan_broker_info results for closed ledgers.
+ *
+ * A closed ledger never changes, so neither do the results computed from it.
+ * Clients polling many loans against the validated ledger are then served
+ * from memory instead of repeating the loan math for every request. Only the
+ * results for the most recent few ledgers are kept.
+ */
+class LendingInfoCache
+{
+    // Enough to span the switch from one validated ledger to the next
+    static constexpr std::size_t maxLedgers = 2;
+    // Limits the memory used if clients query very many objects
+    static constexpr std::size_t maxEntriesPerLedger = 65536;
+
+    using LedgerKey = std::pair<LedgerIndex, uint256>;
+
+    std::mutex mutex_;
+    std::map<LedgerKey, hash_map<uint256, Json::Value>> ledgers_;
+
+public:
+    std::optional<Json::Value>
+    find(ReadView const& ledger, uint256 const& key)
+    {
+        if (ledger.open())
+            return std::nullopt;
+
+        std::lock_guard lock(mutex_);
+        auto const it = ledgers_.find({ledger.seq(), ledger.info().hash});
+        if (it == ledgers_.end())
+            return std::nullopt;
+        auto const result = it->second.find(key);
+        if (result == it->second.end())
+            return std::nullopt;
+        return result->second;
+    }
+
+    void
+    insert(ReadView const& ledger, uint256 const& key, Json::Value const& info)
+    {
+        if (ledger.open())
+            return;
+
+        std::lock_guard lock(mutex_);
+        auto& results = ledgers_[{ledger.seq(), ledger.info().hash}];
+        if (results.size() >= maxEntriesPerLedger)
+            return;
+        results.emplace(key, info);
+
+        // Discard the oldest ledgers
+        while (ledgers_.size() > maxLedgers)
+            ledgers_.erase(ledgers_.begin());
+    }
+};
+
+// Each type of object has its own cache, so a request naming an object of
+// the other type never finds the result computed for it.
+LendingInfoCache&
+lendingInfoCache(LedgerEntryType type)
+{
+    static LendingInfoCache loans;
+    static LendingInfoCache brokers;
+    return type == ltLOAN ? loans : brokers;
+}
+
+// Parses either an object ID in idField, or the pair of fields in ownerField
+// and seqField, and returns the key of the object.
+template <class MakeKey>
+std::optional<uint256>
+parseLendingObject(
+    Json::Value const& params,
+    Json::StaticString const& idField,
+    Json::StaticString const& ownerField,
+    Json::StaticString const& seqField,
+    MakeKey&& makeKey)
+{
+    auto const hasID = params.isMember(idField);
+    auto const hasOwner = params.isMember(ownerField);
+    auto const hasSeq = params.isMember(seqField);
+
+    if (hasID && !hasOwner && !hasSeq)
+    {
+        uint256 key = beast::zero;
+        if (!params[idField].isString() ||
+            !key.parseHex(params[idField].asString()))
+            return std::nullopt;
+        return key;
+    }
+
+    if (!hasID && hasOwner && hasSeq)
+    {
+        auto const& seq = params[seqField];
+        if (!(seq.isInt() || seq.isUInt()) || seq.asDouble() <= 0.0 ||
+            seq.asDouble() > double(Json::Value::maxUInt))
+            return std::nullopt;
+        return makeKey(params[ownerField], seq.asUInt());
+    }
+
+    // Invalid combination of fields
+    return std::nullopt;
+}
+
+Json::Value
+toJson(LoanPaymentQuote const& quote)
+{
+    Json::Value jv(Json::objectValue);
+    jv[jss::total_due] = to_string(quote.totalDue);
+    jv[jss::principal_paid] = to_string(quote.parts.principalPaid);
+    jv[jss::interest_paid] = to_string(quote.parts.interestPaid);
+    jv[jss::fee_paid] = to_string(quote.parts.feePaid);
+    jv[jss::value_change] = to_string(quote.parts.valueChange);
+    return jv;
+}
+
+Json::Value
+loanInfo(ReadView const& ledger, SLE::const_ref loan)
+{
+    auto const broker =
+        ledger.read(keylet::loanbroker(loan->at(sfLoanBrokerID)));
+    auto const vault =
+        broker ? ledger.read(keylet::vault(broker->at(sfVaultID))) : nullptr;
+    if (!broker || !vault)
+        return Json::nullValue;  // LCOV_EXCL_LINE
+
+    // Compute the amounts the same way LoanPay would
+    NumberSO const stNumberSO{ledger.rules().enabled(fixUniversalNumber)};
+    CurrentTransactionRulesGuard const rulesGuard(ledger.rules());
+    auto const due =
+        computeLoanAmountsDue(vault->at(sfAsset), ledger, loan, broker);
+
+    Json::Value info(Json::objectValue);
+    info[jss::loan] = loan->getJson(JsonOptions::none);
+
+    Json::Value& state = info[jss::loan_state];
+    state[jss::total_value_outstanding] =
+        to_string(due.state.valueOutstanding);
+    state[jss::principal_outstanding] =
+        to_string(due.state.principalOutstanding);
+    state[jss::interest_outstanding] =
+        to_string(due.state.interestOutstanding);
+    state[jss::interest_due] = to_string(due.state.interestDue);
+    state[jss::management_fee_outstanding] =
+        to_string(due.state.managementFeeDue);
+
+    if (due.nextPayment)
+    {
+        Json::Value& next = info[jss::next_payment];
+        next = toJson(*due.nextPayment);
+        if (due.nextDueDate)
+            next[jss::due_date] = *due.nextDueDate;
+        next[jss::late] = due.late;
+    }
+    if (due.fullPayment)
+        info[jss::full_payment] = toJson(*due.fullPayment);
+
+    // The time the interest and late payment computations are based on
+    info[jss::parent_close_time] =
+        ledger.parentCloseTime().time_since_epoch().count();
+    return info;
+}
+
+Json::Value
+loanBrokerInfo(ReadView const& ledger, SLE::const_ref broker)
+{
+    auto const vault = ledger.read(keylet::vault(broker->at(sfVaultID)));
+    if (!vault)
+        return Json::nullValue;  // LCOV_EXCL_LINE
+
+    NumberSO const stNumberSO{ledger.rules().enabled(fixUniversalNumber)};
+    CurrentTransactionRulesGuard const rulesGuard(ledger.rules());
+
+    // The same minimum LoanBrokerCoverWithdraw enforces
+    Number const debtTotal = broker->at(sfDebtTotal);
+    Number const coverAvailable = broker->at(sfCoverAvailable);
+    Number const coverMinimum = roundToAsset(
+        vault->at(sfAsset),
+        tenthBipsOfValue(
+            debtTotal, TenthBips32(broker->at(sfCoverRateMinimum))),
+        debtTotal.exponent());
+
+    Json::Value info(Json::objectValue);
+    info[jss::loan_broker] = broker->getJson(JsonOptions::none);
+    info[jss::debt_total] = to_string(debtTotal);
+    info[jss::cover_available] = to_string(coverAvailable);
+    info[jss::cover_minimum] = to_string(coverMinimum);
+    if (debtTotal != beast::zero)
+        info[jss::cover_ratio] = to_string(coverAvailable / debtTotal);
+    return info;
+}
+
+// Looks up the ledger and the object, and adds the result of computeInfo to
+// the response, reusing a cached result when there is one.
+template <class ParseKey, class ComputeInfo>
+Json::Value
+doLendingInfo(
+    RPC::JsonContext& context,
+    LedgerEntryType type,
+    ParseKey&& parseKey,
+    ComputeInfo&& computeInfo)
+{
+    std::shared_ptr<ReadView const> lpLedger;
+    auto jvResult = RPC::lookupLedger(lpLedger, context);
+
+    if (!lpLedger)
+        return jvResult;
+
+    auto const key = parseKey(context.params);
+    if (!key)
+    {
+        RPC::inject_error(rpcINVALID_PARAMS, jvResult);
+        jvResult[jss::error] = "malformedRequest";
+        return jvResult;
+    }
+
+    auto& cache = lendingInfoCache(type);
+    auto info = cache.find(*lpLedger, *key);
+    if (!info)
+    {
+        auto const sle = lpLedger->read(Keylet{type, *key});
+        if (!sle)
+        {
+            jvResult[jss::error] = "entryNotFound";
+            return jvResult;
+        }
+        info = computeInfo(*lpLedger, sle);
+        if (info->isNull())
+        {
+            // LCOV_EXCL_START
+            jvResult[jss::error] = "entryNotFound";
+            return jvResult;
+            // LCOV_EXCL_STOP
+        }
+        cache.insert(*lpLedger, *key, *info);
+    }
+
+    for (auto it = info->begin(); it != info->end(); ++it)
+        jvResult[it.memberName()] = *it;
+    return jvResult;
+}
+
+}  // namespace
+
+Json::Value
+doLoanInfo(RPC::JsonContext& context)
+{
+    return doLendingInfo(
+        context,
+        ltLOAN,
+        [](Json::Value const& params) {
+            return parseLendingObject(
+                params,
+                jss::loan_id,
+                jss::loan_broker_id,
+                jss::loan_seq,
+                [](Json::Value const& brokerID,
+                   std::uint32_t seq) -> std::optional<uint256> {
+                    uint256 id;
+                    if (!brokerID.isString() ||
+                        !id.parseHex(brokerID.asString()))
+                        return std::nullopt;
+                    return keylet::loan(id, seq).key;
+                });
+        },
+        loanInfo);
+}
+
+Json::Value
+doLoanBrokerInfo(RPC::JsonContext& context)
+{
+    return doLendingInfo(
+        context,
+        ltLOAN_BROKER,
+        [](Json::Value const& params) {
+            return parseLendingObject(
+                params,
+                jss::loan_broker_id,
+                jss::owner,
+                jss::seq,
+                [](Json::Value const& owner,
+                   std::uint32_t seq) -> std::optional<uint256> {
+                    if (!owner.isString())
+                        return std::nullopt;
+                    auto const id = parseBase58<AccountID>(owner.asString());
+                    if (!id)
+                        return std::nullopt;
+                    return keylet::loanbroker(*id, seq).key;
+                });
+        },
+        loanBrokerInfo);
+}
+
+}  // namespace ripple
@@ -0,0 +1,133 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <xrpld/app/ledger/LoanIndex.h>
+#include <xrpld/app/main/Application.h>
+#include <xrpld/rpc/Context.h>
+#include <xrpld/rpc/detail/RPCHelpers.h>
+#include <xrpld/rpc/detail/Tuning.h>
+
+#include <xrpl/beast/core/LexicalCast.h>
+#include <xrpl/protocol/ErrorCodes.h>
+#include <xrpl/protocol/RPCErr.h>
+#include <xrpl/protocol/jss.h>
+#include <xrpl/resource/Fees.h>
+
+#include <limits>
+#include <string>
+
+namespace ripple {
+
+/** Returns the active loans of a LoanBroker, ordered by next payment due date.
+    {
+      loan_broker_id: <string>
+      due_before: <unsigned integer> // optional, seconds since the network
+                                     // epoch, defaults to all loans
+      limit: <integer> // optional
+      marker: <opaque> // optional, resume previous query
+    }
+
+    The loans come from an index that follows the published ledgers, so the
+    result reflects the ledger given by ledger_index and ledger_hash in the
+    response. A loan is late if its due date is before the close time of that
+    ledger.
+*/
+Json::Value
+doLoansDue(RPC::JsonContext& context)
+{
+    auto const& params = context.params;
+
+    if (!params.isMember(jss::loan_broker_id))
+        return RPC::missing_field_error(jss::loan_broker_id);
+
+    uint256 brokerID;
+    if (!params[jss::loan_broker_id].isString() ||
+        !brokerID.parseHex(params[jss::loan_broker_id].asString()))
+        return RPC::invalid_field_error(jss::loan_broker_id);
+
+    std::uint32_t dueBefore = std::numeric_limits<std::uint32_t>::max();
+    if (params.isMember(jss::due_before))
+    {
+        auto const& due = params[jss::due_before];
+        if (!due.isUInt() && !(due.isInt() && due.asInt() >= 0))
+            return RPC::expected_field_error(
+                jss::due_before, "unsigned integer");
+        dueBefore = due.asUInt();
+    }
+
+    unsigned int limit;
+    if (auto err = readLimitField(limit, RPC::Tuning::loansDue, context))
+        return *err;
+
+    std::optional<LoanIndex::Entry> marker;
+    if (params.isMember(jss::marker))
+    {
+        auto const& m = params[jss::marker];
+        if (!m.isString())
+            return RPC::expected_field_error(jss::marker, "string");
+
+        auto const& markerStr = m.asString();
+        auto const& idx = markerStr.find(',');
+        if (idx == std::string::npos)
+            return RPC::invalid_field_error(jss::marker);
+
+        LoanIndex::Entry entry;
+        if (!beast::lexicalCastChecked(entry.first, markerStr.substr(0, idx)))
+            return RPC::invalid_field_error(jss::marker);
+
+        if (!entry.second.parseHex(markerStr.substr(idx + 1)))
+            return RPC::invalid_field_error(jss::marker);
+
+        marker = entry;
+    }
+
+    auto const loans = context.app.getLoanIndex().getLoansDue(
+        brokerID, dueBefore, marker, limit);
+    if (!loans)
+        return rpcError(rpcNOT_SYNCED);
+
+    Json::Value result(Json::objectValue);
+    result[jss::loan_broker_id] = to_string(brokerID);
+    result[jss::ledger_index] = loans->ledgerSeq;
+    result[jss::ledger_hash] = to_string(loans->ledgerHash);
+    result[jss::validated] = true;
+
+    Json::Value& jvLoans = (result[jss::loans] = Json::arrayValue);
+    for (auto const& [dueDate, loanID] : loans->loans)
+    {
+        Json::Value& jvLoan = jvLoans.append(Json::objectValue);
+        jvLoan[jss::loan_id] = to_string(loanID);
+        jvLoan[jss::due_date] = dueDate;
+        jvLoan[jss::late] = dueDate < loans->closeTime;
+    }
+
+    if (loans->marker)
+    {
+        result[jss::limit] = limit;
+        result[jss::marker] = std::to_string(loans->marker->first) + "," +
+            to_string(loans->marker->second);
+    }
+
+    // Without the index, the loans were read from the ledger
+    context.loadType = loans->indexed ? Resource::feeMediumBurdenRPC
+                                      : Resource::feeHeavyBurdenRPC;
+    return result;
+}
+
+}  // namespace ripple
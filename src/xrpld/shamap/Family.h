@@ -27,9 +27,14 @@
 #include <xrpl/beast/utility/Journal.h>
 
 #include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
 
 namespace ripple {
 
+class SHAMapSnapshotFile;
+
 class Family
 {
 public:
@@ -83,6 +88,53 @@ public:
 
     virtual void
     reset() = 0;
+
+    /** Calls a function for every index in [0, count), possibly in parallel.
+
+        Used to hash and flush independent subtrees of a SHAMap. Returns once
+        every call has returned. The default makes the calls in order on the
+        calling thread.
+
+        @param f Has a signature of void(std::size_t).
+    */
+    virtual void
+    runParallel(std::size_t count, std::function<void(std::size_t)> f)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            f(i);
+    }
+
+    /** The most nodes a walk of a SHAMap reads from the database at once. */
+    virtual std::size_t
+    fetchBatchSize() const
+    {
+        return 256;
+    }
+
+    /** Fetch several node objects from the database.
+
+        Used by walks of a SHAMap to read many nodes at once. The default
+        reads them all with a single fetchBatch.
+
+        @return The objects, in the order of their keys, with nullptr for any
+                that couldn't be retrieved.
+    */
+    virtual std::vector<std::shared_ptr<NodeObject>>
+    fetchBatch(std::vector<uint256> const& hashes)
+    {
+        return db().fetchBatch(hashes);
+    }
+
+    /** The file the nodes of this family are read from, if any.
+
+        A family with a snapshot file reads every node from the file, in
+        place, and never uses the database. The default has no file.
+    */
+    virtual SHAMapSnapshotFile const*
+    snapshotFile() const
+    {
+        return nullptr;
+    }
 };
 
 }  // namespace ripple
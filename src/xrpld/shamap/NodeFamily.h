@@ -87,6 +87,16 @@ public:
         acquire(hash, seq);
     }
 
+    void
+    runParallel(std::size_t count, std::function<void(std::size_t)> f)
+        override;
+
+    std::size_t
+    fetchBatchSize() const override;
+
+    std::vector<std::shared_ptr<NodeObject>>
+    fetchBatch(std::vector<uint256> const& hashes) override;
+
 private:
     Application& app_;
     NodeStore::Database& db_;
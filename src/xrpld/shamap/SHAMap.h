@@ -36,6 +36,7 @@
 #include <xrpl/beast/utility/Journal.h>
 #include <xrpl/beast/utility/instrumentation.h>
 
+#include <array>
 #include <set>
 #include <stack>
 #include <vector>
@@ -247,6 +248,19 @@ public:
     void
     visitNodes(std::function<bool(SHAMapTreeNode&)> const& function) const;
 
+    /**  Visit every node in this SHAMap, reading nodes in batches
+
+         Like visitNodes, but the children of many inner nodes are read from
+         the database at once, rather than one node at a time. A node is
+         visited before its children, but otherwise the order is unspecified.
+
+         @param function called with every node visited.
+         If function returns false, visitNodesBatched exits.
+    */
+    void
+    visitNodesBatched(
+        std::function<bool(SHAMapTreeNode&)> const& function) const;
+
     /**  Visit every node in this SHAMap that
          is not present in the specified SHAMap
 
@@ -486,6 +500,22 @@ private:
     intr_ptr::SharedPtr<SHAMapTreeNode>
     descendNoStore(SHAMapInnerNode&, int branch) const;
 
+    using Children =
+        std::array<intr_ptr::SharedPtr<SHAMapTreeNode>, branchFactor>;
+
+    /** Returns the children of several inner nodes.
+
+        The children which are not in memory are read from the database with
+        one Family::fetchBatch. Like descendNoStore, the children read are not
+        hooked into their parents. A child which can't be read is nullptr.
+    */
+    std::vector<Children>
+    fetchChildren(std::vector<SHAMapInnerNode*> const& parents) const;
+
+    /** The number of inner nodes whose children a walk reads at once. */
+    std::size_t
+    fetchBatchParents() const;
+
     /** If there is only one leaf below this node, get its contents */
     boost::intrusive_ptr<SHAMapItem const> const&
     onlyBelow(SHAMapTreeNode*) const;
@@ -508,6 +538,12 @@ private:
         int& maxCount) const;
     int
     walkSubTree(bool doWrite, NodeObjectType t);
+    intr_ptr::SharedPtr<SHAMapInnerNode>
+    walkInner(
+        intr_ptr::SharedPtr<SHAMapInnerNode> node,
+        bool doWrite,
+        NodeObjectType t,
+        int& flushed) const;
 
     // Structure to track information about call to
     // getMissingNodes while it's in progress
@@ -586,6 +622,12 @@ private:
     finishFetch(
         SHAMapHash const& hash,
         std::shared_ptr<NodeObject> const& object) const;
+
+    // Build a node from its serialized form, or report it missing if there
+    // is none
+    intr_ptr::SharedPtr<SHAMapTreeNode>
+    finishFetch(SHAMapHash const& hash, std::optional<Slice> const& data)
+        const;
 };
 
 inline void
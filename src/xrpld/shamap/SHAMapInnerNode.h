@@ -26,6 +26,7 @@
 #include <xrpl/basics/IntrusivePointer.h>
 
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <optional>
 #include <string>
@@ -98,6 +99,25 @@ private:
     iterNonEmptyChildIndexes(F&& f) const;
 
 public:
+    /** Counts of the memory that holds the hashes and children of all the
+        inner nodes. The allocations include those made when the arrays of a
+        node grow or shrink.
+     */
+    struct ArenaCounts
+    {
+        // Bytes in the slabs the arrays are allocated from
+        std::size_t reserved = 0;
+
+        // Bytes of the arrays currently allocated
+        std::size_t used = 0;
+
+        std::uint64_t allocations = 0;
+        std::uint64_t deallocations = 0;
+    };
+
+    static ArenaCounts
+    getArenaCounts();
+
     explicit SHAMapInnerNode(
         std::uint32_t cowid,
         std::uint8_t numAllocatedChildren = 2);
@@ -173,6 +193,10 @@ public:
     void
     updateHashDeep();
 
+    /** Take the current hash of each child, without rehashing this node. */
+    void
+    updateChildHashes();
+
     void
     serializeForWire(Serializer&) const override;
 
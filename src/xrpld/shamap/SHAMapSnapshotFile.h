@@ -0,0 +1,174 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#ifndef RIPPLE_SHAMAP_SHAMAPSNAPSHOTFILE_H_INCLUDED
+#define RIPPLE_SHAMAP_SHAMAPSNAPSHOTFILE_H_INCLUDED
+
+#include <xrpl/basics/Slice.h>
+#include <xrpl/basics/base_uint.h>
+
+#include <boost/endian/buffers.hpp>
+#include <boost/filesystem/path.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace ripple {
+
+class SHAMap;
+
+/** A read-only file of the nodes of one or more SHAMaps, found by hash.
+
+    The file is memory-mapped. Reading a node returns a view of its
+    serialized form in the mapping, so nodes are read without copying them
+    and without going through the node store or its caches.
+
+    The file is laid out as follows, with every integer little-endian:
+
+        Header    The magic, the version, the number of nodes and where the
+                  other parts start.
+        User data An opaque block the writer supplies, such as the header of
+                  the ledger the maps belong to.
+        Nodes     Each node as SHAMapTreeNode::serializeWithPrefix writes it,
+                  one after another.
+        Index     An entry for each node, sorted by hash, with the offset and
+                  size of the node.
+        Fanout    For each value of the first two bytes of a hash, the number
+                  of index entries with a smaller value, followed by the total
+                  number of entries. This narrows a lookup to a few entries.
+*/
+class SHAMapSnapshotFile
+{
+public:
+    /** Write the nodes of some maps to a new file.
+
+        The file is written under a temporary name and renamed into place
+        once complete, so a file at the given path is always whole. Every
+        node of the maps is read, so they must be complete.
+
+        The index is sorted in runs, which are kept in a scratch file next to
+        the snapshot and merged as the index is written. Only one run is held
+        in memory, so the memory used doesn't grow with the size of the maps.
+
+        @param runSize The number of index entries in a run.
+        @return The number of nodes written.
+        @throws std::exception if the file can't be written, or a node of
+                the maps can't be read.
+    */
+    static std::size_t
+    write(
+        boost::filesystem::path const& path,
+        Slice userData,
+        std::vector<SHAMap const*> const& maps,
+        std::size_t runSize = defaultRunSize);
+
+    /** Open and map a file.
+
+        @throws std::runtime_error if the file is missing or malformed.
+    */
+    explicit SHAMapSnapshotFile(boost::filesystem::path const& path);
+
+    SHAMapSnapshotFile(SHAMapSnapshotFile const&) = delete;
+    SHAMapSnapshotFile&
+    operator=(SHAMapSnapshotFile const&) = delete;
+
+    /** Return the serialized form of a node, or nothing if the file doesn't
+        have the node. The view is valid as long as this object is.
+
+        The node is hashed and checked against the hash it was asked for, so
+        a damaged node reads as missing.
+    */
+    std::optional<Slice>
+    fetch(uint256 const& hash) const;
+
+    /** The user data given when the file was written. */
+    Slice
+    userData() const
+    {
+        return userData_;
+    }
+
+    /** The number of nodes in the file. */
+    std::size_t
+    size() const
+    {
+        return count_;
+    }
+
+    boost::filesystem::path const&
+    path() const
+    {
+        return path_;
+    }
+
+    // About 11 MiB of index entries
+    static constexpr std::size_t defaultRunSize = 262144;
+
+private:
+    struct Header
+    {
+        std::array<char, 8> magic;
+        boost::endian::little_uint32_buf_t version;
+        boost::endian::little_uint32_buf_t userSize;
+        boost::endian::little_uint64_buf_t count;
+        boost::endian::little_uint64_buf_t nodesOffset;
+        boost::endian::little_uint64_buf_t indexOffset;
+        boost::endian::little_uint64_buf_t fanoutOffset;
+    };
+
+    struct Entry
+    {
+        std::array<std::uint8_t, uint256::bytes> hash;
+        boost::endian::little_uint64_buf_t offset;
+        boost::endian::little_uint32_buf_t size;
+    };
+
+    // Two bytes of the hash select a slot of the fanout
+    static constexpr std::size_t fanoutSlots = 65536;
+
+    static constexpr std::array<char, 8> magic_{
+        'X', 'R', 'P', 'L', 'S', 'N', 'A', 'P'};
+    static constexpr std::uint32_t version_ = 1;
+
+    static std::size_t
+    slot(std::uint8_t const* hash)
+    {
+        return (std::size_t{hash[0]} << 8) | hash[1];
+    }
+
+    boost::filesystem::path const path_;
+    boost::interprocess::file_mapping file_;
+    boost::interprocess::mapped_region region_;
+
+    Slice userData_;
+    std::size_t count_ = 0;
+    std::uint8_t const* base_ = nullptr;
+    std::size_t nodesBegin_ = 0;
+    std::size_t nodesEnd_ = 0;
+    Entry const* index_ = nullptr;
+    boost::endian::little_uint64_buf_t const* fanout_ = nullptr;
+};
+
+}  // namespace ripple
+
+#endif
@@ -29,7 +29,9 @@
 #include <xrpl/protocol/Serializer.h>
 
 #include <cstdint>
+#include <span>
 #include <string>
+#include <vector>
 
 namespace ripple {
 
@@ -140,6 +142,29 @@ public:
     virtual void
     updateHash() = 0;
 
+    /** Storage for updateHashes, kept from one batch to the next so that
+        hashing a batch reuses the serializers of the batch before.
+    */
+    struct HashBuffers
+    {
+        std::vector<SHAMapTreeNode*> nodes;
+        std::vector<Serializer> data;
+        std::vector<Slice> messages;
+        std::vector<uint256> digests;
+    };
+
+    /** Recalculate the hashes of several nodes at once.
+
+        Leaves are hashed as by updateHash, and inner nodes as by
+        updateHashDeep, but all of the nodes are hashed together with
+        sha512HalfBatch. The serializations of all of the nodes are held at
+        once, so callers should pass a bounded number of nodes.
+    */
+    static void
+    updateHashes(
+        std::span<SHAMapTreeNode* const> nodes,
+        HashBuffers& buffers);
+
     /** Return the hash of this node. */
     SHAMapHash const&
     getHash() const
@@ -0,0 +1,93 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#ifndef RIPPLE_SHAMAP_SNAPSHOTFAMILY_H_INCLUDED
+#define RIPPLE_SHAMAP_SNAPSHOTFAMILY_H_INCLUDED
+
+#include <xrpld/shamap/Family.h>
+#include <xrpld/shamap/SHAMapSnapshotFile.h>
+
+namespace ripple {
+
+/** A family of read-only SHAMaps whose nodes are read from a snapshot file.
+
+    The family has caches of its own, so traversing its maps doesn't evict
+    the nodes other maps need from the caches of the node family. It has no
+    database: a node that isn't in the file is missing, and can't be acquired.
+*/
+class SnapshotFamily : public Family
+{
+public:
+    SnapshotFamily(
+        std::shared_ptr<SHAMapSnapshotFile const> file,
+        beast::Journal j);
+
+    NodeStore::Database&
+    db() override;
+
+    NodeStore::Database const&
+    db() const override;
+
+    beast::Journal const&
+    journal() override
+    {
+        return j_;
+    }
+
+    std::shared_ptr<FullBelowCache>
+    getFullBelowCache() override
+    {
+        return fbCache_;
+    }
+
+    std::shared_ptr<TreeNodeCache>
+    getTreeNodeCache() override
+    {
+        return tnCache_;
+    }
+
+    void
+    sweep() override;
+
+    void
+    reset() override;
+
+    void
+    missingNodeAcquireBySeq(std::uint32_t seq, uint256 const& hash) override;
+
+    void
+    missingNodeAcquireByHash(uint256 const& hash, std::uint32_t seq) override;
+
+    SHAMapSnapshotFile const*
+    snapshotFile() const override
+    {
+        return file_.get();
+    }
+
+private:
+    std::shared_ptr<SHAMapSnapshotFile const> const file_;
+    beast::Journal const j_;
+
+    std::shared_ptr<FullBelowCache> fbCache_;
+    std::shared_ptr<TreeNodeCache> tnCache_;
+};
+
+}  // namespace ripple
+
+#endif
@@ -23,11 +23,13 @@
 #include <xrpld/shamap/SHAMapTreeNode.h>
 
 #include <xrpl/basics/IntrusivePointer.h>
-#include <xrpl/basics/TaggedCache.h>
+#include <xrpl/basics/ShardedTaggedCache.h>
 
 namespace ripple {
 
-using TreeNodeCache = TaggedCache<
+// Every SHAMap lookup that misses the map itself goes through this cache, so
+// it is sharded to keep its lookups and sweeps from contending on one lock.
+using TreeNodeCache = ShardedTaggedCache<
     uint256,
     SHAMapTreeNode,
     /*IsKeyCache*/ false,
@@ -20,10 +20,14 @@
 #include <xrpld/app/ledger/LedgerMaster.h>
 #include <xrpld/app/main/Application.h>
 #include <xrpld/app/main/Tuning.h>
+#include <xrpld/core/Config.h>
+#include <xrpld/core/JobQueue.h>
 #include <xrpld/shamap/NodeFamily.h>
 
 #include <xrpl/basics/TaggedCache.ipp>
 
+#include <algorithm>
+
 namespace ripple {
 
 NodeFamily::NodeFamily(Application& app, CollectorManager& cm)
@@ -95,6 +99,50 @@ NodeFamily::missingNodeAcquireBySeq(std::uint32_t seq, uint256 const& nodeHash)
     }
 }
 
+void
+NodeFamily::runParallel(std::size_t count, std::function<void(std::size_t)> f)
+{
+    auto const workers = app_.config().PARALLEL_HASH_WORKERS;
+    if (workers == 0)
+        return Family::runParallel(count, std::move(f));
+
+    app_.getJobQueue().runParallel(
+        jtLEDGER_HASH, "hashLedger", workers, count, std::move(f));
+}
+
+std::size_t
+NodeFamily::fetchBatchSize() const
+{
+    return app_.config().FETCH_BATCH_SIZE;
+}
+
+std::vector<std::shared_ptr<NodeObject>>
+NodeFamily::fetchBatch(std::vector<uint256> const& hashes)
+{
+    auto const inFlight = app_.config().FETCH_BATCHES_IN_FLIGHT;
+    if (inFlight <= 1 || hashes.size() < 2)
+        return db_.fetchBatch(hashes);
+
+    // Split the reads evenly between the threads
+    auto const perBatch = (hashes.size() + inFlight - 1) / inFlight;
+    auto const batches = (hashes.size() + perBatch - 1) / perBatch;
+
+    std::vector<std::shared_ptr<NodeObject>> results(hashes.size());
+    app_.getJobQueue().runParallel(
+        jtNODE_FETCH,
+        "fetchNodes",
+        inFlight - 1,
+        batches,
+        [&](std::size_t i) {
+            auto const first = i * perBatch;
+            auto const last = std::min(first + perBatch, hashes.size());
+            auto objects = db_.fetchBatch(std::vector<uint256>(
+                hashes.begin() + first, hashes.begin() + last));
+            std::move(objects.begin(), objects.end(), results.begin() + first);
+        });
+    return results;
+}
+
 void
 NodeFamily::acquire(uint256 const& hash, std::uint32_t seq)
 {
@@ -20,6 +20,7 @@
 #include <xrpld/shamap/SHAMap.h>
 #include <xrpld/shamap/SHAMapAccountStateLeafNode.h>
 #include <xrpld/shamap/SHAMapNodeID.h>
+#include <xrpld/shamap/SHAMapSnapshotFile.h>
 #include <xrpld/shamap/SHAMapSyncFilter.h>
 #include <xrpld/shamap/SHAMapTxLeafNode.h>
 #include <xrpld/shamap/SHAMapTxPlusMetaLeafNode.h>
@@ -170,6 +171,9 @@ intr_ptr::SharedPtr<SHAMapTreeNode>
 SHAMap::fetchNodeFromDB(SHAMapHash const& hash) const
 {
     XRPL_ASSERT(backed_, "ripple::SHAMap::fetchNodeFromDB : is backed");
+    if (auto const file = f_.snapshotFile())
+        return finishFetch(hash, file->fetch(hash.as_uint256()));
+
     auto obj = f_.db().fetchNodeObject(hash.as_uint256(), ledgerSeq_);
     return finishFetch(hash, obj);
 }
@@ -178,12 +182,21 @@ intr_ptr::SharedPtr<SHAMapTreeNode>
 SHAMap::finishFetch(
     SHAMapHash const& hash,
     std::shared_ptr<NodeObject> const& object) const
+{
+    if (!object)
+        return finishFetch(hash, std::nullopt);
+    return finishFetch(hash, makeSlice(object->getData()));
+}
+
+intr_ptr::SharedPtr<SHAMapTreeNode>
+SHAMap::finishFetch(SHAMapHash const& hash, std::optional<Slice> const& data)
+    const
 {
     XRPL_ASSERT(backed_, "ripple::SHAMap::finishFetch : is backed");
 
     try
     {
-        if (!object)
+        if (!data)
         {
             if (full_)
             {
@@ -193,8 +206,7 @@ SHAMap::finishFetch(
             return {};
         }
 
-        auto node =
-            SHAMapTreeNode::makeFromPrefix(makeSlice(object->getData()), hash);
+        auto node = SHAMapTreeNode::makeFromPrefix(*data, hash);
         if (node)
             canonicalize(hash, node);
         return node;
@@ -356,6 +368,73 @@ SHAMap::descendNoStore(SHAMapInnerNode& parent, int branch) const
     return ret;
 }
 
+std::vector<SHAMap::Children>
+SHAMap::fetchChildren(std::vector<SHAMapInnerNode*> const& parents) const
+{
+    std::vector<Children> children(parents.size());
+
+    // The children to read, by parent and branch
+    std::vector<std::pair<std::size_t, int>> wanted;
+    std::vector<uint256> hashes;
+
+    for (std::size_t i = 0; i < parents.size(); ++i)
+    {
+        auto const parent = parents[i];
+        for (int branch = 0; branch < branchFactor; ++branch)
+        {
+            if (parent->isEmptyBranch(branch))
+                continue;
+
+            auto& child = children[i][branch];
+            child = parent->getChild(branch);
+            if (child || !backed_)
+                continue;
+
+            auto const& hash = parent->getChildHash(branch);
+            child = cacheLookup(hash);
+            if (child)
+                continue;
+
+            wanted.emplace_back(i, branch);
+            hashes.push_back(hash.as_uint256());
+        }
+    }
+
+    if (hashes.empty())
+        return children;
+
+    // A snapshot file is read in place, so there is nothing to batch
+    if (auto const file = f_.snapshotFile())
+    {
+        for (std::size_t j = 0; j < wanted.size(); ++j)
+        {
+            auto const [i, branch] = wanted[j];
+            children[i][branch] =
+                finishFetch(SHAMapHash{hashes[j]}, file->fetch(hashes[j]));
+        }
+        return children;
+    }
+
+    auto const objects = f_.fetchBatch(hashes);
+    XRPL_ASSERT(
+        objects.size() == hashes.size(),
+        "ripple::SHAMap::fetchChildren : all objects fetched");
+    for (std::size_t j = 0; j < wanted.size(); ++j)
+    {
+        auto const [i, branch] = wanted[j];
+        children[i][branch] = finishFetch(SHAMapHash{hashes[j]}, objects[j]);
+    }
+
+    return children;
+}
+
+std::size_t
+SHAMap::fetchBatchParents() const
+{
+    // Each inner node has up to branchFactor children to read
+    return std::max<std::size_t>(1, f_.fetchBatchSize() / branchFactor);
+}
+
 std::pair<SHAMapTreeNode*, SHAMapNodeID>
 SHAMap::descend(
     SHAMapInnerNode* parent,
@@ -412,7 +491,12 @@ SHAMap::descendAsync(
         if (filter)
             ptr = checkFilter(hash, filter);
 
-        if (!ptr && backed_)
+        // A snapshot file is read in place, so there is nothing to wait for
+        if (!ptr && backed_ && f_.snapshotFile())
+        {
+            ptr = fetchNodeFromDB(hash);
+        }
+        else if (!ptr && backed_)
         {
             f_.db().asyncFetch(
                 hash.as_uint256(),
@@ -1075,104 +1159,152 @@ SHAMap::walkSubTree(bool doWrite, NodeObjectType t)
         return 1;
     }
 
-    // Stack of {parent,index,child} pointers representing
-    // inner nodes we are in the process of flushing
-    using StackEntry = std::pair<intr_ptr::SharedPtr<SHAMapInnerNode>, int>;
-    std::stack<StackEntry, std::vector<StackEntry>> stack;
-
     node = preFlushNode(std::move(node));
 
-    int pos = 0;
+    // The dirty inner nodes below the root are independent subtrees, so they
+    // can be flushed in parallel. The root is hashed after all of them, so
+    // the hashes are the same as when flushing on one thread.
+    std::vector<std::pair<int, intr_ptr::SharedPtr<SHAMapInnerNode>>> subtrees;
+    for (int branch = 0; branch < branchFactor; ++branch)
+    {
+        if (node->isEmptyBranch(branch))
+            continue;
+
+        auto child = node->getChild(branch);
+        if (child && child->cowid() != 0 && child->isInner())
+            subtrees.emplace_back(
+                branch,
+                intr_ptr::static_pointer_cast<SHAMapInnerNode>(
+                    std::move(child)));
+    }
+
+    if (subtrees.size() > 1)
+    {
+        std::vector<int> counts(subtrees.size(), 0);
+        f_.runParallel(subtrees.size(), [&](std::size_t i) {
+            auto& subtree = subtrees[i].second;
+            subtree = walkInner(
+                preFlushNode(std::move(subtree)), doWrite, t, counts[i]);
+        });
+
+        for (std::size_t i = 0; i < subtrees.size(); ++i)
+        {
+            node->shareChild(subtrees[i].first, subtrees[i].second);
+            flushed += counts[i];
+        }
+    }
+
+    // Last inner node is the new root_
+    root_ = walkInner(std::move(node), doWrite, t, flushed);
+
+    return flushed;
+}
+
+intr_ptr::SharedPtr<SHAMapInnerNode>
+SHAMap::walkInner(
+    intr_ptr::SharedPtr<SHAMapInnerNode> node,
+    bool doWrite,
+    NodeObjectType t,
+    int& flushed) const
+{
+    XRPL_ASSERT(
+        node->cowid() == cowid_,
+        "ripple::SHAMap::walkInner : node cowid do match");
+
+    // A node that needs to be flushed, and where it hangs from its parent
+    struct Dirty
+    {
+        intr_ptr::SharedPtr<SHAMapTreeNode> node;
+        SHAMapInnerNode* parent;
+        int branch;
+    };
+
+    // The nodes to flush, by depth below node. We can't flush an inner node
+    // until we flush its children, but the nodes at one depth don't depend on
+    // each other, so they are hashed together.
+    std::vector<std::vector<Dirty>> levels;
+    levels.push_back({{std::move(node), nullptr, 0}});
 
-    // We can't flush an inner node until we flush its children
     while (1)
     {
-        while (pos < branchFactor)
+        std::vector<Dirty> next;
+        for (auto const& dirty : levels.back())
         {
-            if (node->isEmptyBranch(pos))
-            {
-                ++pos;
-            }
-            else
+            if (!dirty.node->isInner())
+                continue;
+
+            auto const inner = static_cast<SHAMapInnerNode*>(dirty.node.get());
+            for (int branch = 0; branch < branchFactor; ++branch)
             {
+                if (inner->isEmptyBranch(branch))
+                    continue;
+
                 // No need to do I/O. If the node isn't linked,
                 // it can't need to be flushed
-                int branch = pos;
-                auto child = node->getChild(pos++);
-
+                auto child = inner->getChild(branch);
                 if (child && (child->cowid() != 0))
-                {
-                    // This is a node that needs to be flushed
+                    next.push_back(
+                        {preFlushNode(std::move(child)), inner, branch});
+            }
+        }
 
-                    child = preFlushNode(std::move(child));
+        if (next.empty())
+            break;
 
-                    if (child->isInner())
-                    {
-                        // save our place and work on this node
-
-                        stack.emplace(std::move(node), branch);
-                        // The semantics of this changes when we move to c++-20
-                        // Right now no move will occur; With c++-20 child will
-                        // be moved from.
-                        node = intr_ptr::static_pointer_cast<SHAMapInnerNode>(
-                            std::move(child));
-                        pos = 0;
-                    }
-                    else
-                    {
-                        // flush this leaf
-                        ++flushed;
+        levels.push_back(std::move(next));
+    }
 
-                        XRPL_ASSERT(
-                            node->cowid() == cowid_,
-                            "ripple::SHAMap::walkSubTree : node cowid do "
-                            "match");
-                        child->updateHash();
-                        child->unshare();
+    // Hash the nodes of a level a few at a time, so the serializations held
+    // at once stay bounded however many nodes are dirty
+    static constexpr std::size_t hashBatchSize = 64;
+    SHAMapTreeNode::HashBuffers buffers;
+    std::vector<SHAMapTreeNode*> nodes;
+    nodes.reserve(hashBatchSize);
 
-                        if (doWrite)
-                            child = writeNode(t, std::move(child));
+    for (auto level = levels.rbegin(); level != levels.rend(); ++level)
+    {
+        for (std::size_t begin = 0; begin < level->size();
+             begin += hashBatchSize)
+        {
+            auto const end = std::min(level->size(), begin + hashBatchSize);
 
-                        node->shareChild(branch, child);
-                    }
-                }
-            }
-        }
+            nodes.clear();
+            for (auto i = begin; i < end; ++i)
+                nodes.push_back((*level)[i].node.get());
 
-        // update the hash of this inner node
-        node->updateHashDeep();
+            // update the hashes of these nodes
+            SHAMapTreeNode::updateHashes(nodes, buffers);
 
-        // This inner node can now be shared
-        node->unshare();
+            for (auto i = begin; i < end; ++i)
+            {
+                auto& dirty = (*level)[i];
 
-        if (doWrite)
-            node = intr_ptr::static_pointer_cast<SHAMapInnerNode>(
-                writeNode(t, std::move(node)));
+                // This node can now be shared
+                dirty.node->unshare();
 
-        ++flushed;
+                if (doWrite)
+                    dirty.node = writeNode(t, std::move(dirty.node));
 
-        if (stack.empty())
-            break;
+                ++flushed;
 
-        auto parent = std::move(stack.top().first);
-        pos = stack.top().second;
-        stack.pop();
+                if (!dirty.parent)
+                    continue;
 
-        // Hook this inner node to its parent
-        XRPL_ASSERT(
-            parent->cowid() == cowid_,
-            "ripple::SHAMap::walkSubTree : parent cowid do match");
-        parent->shareChild(pos, node);
+                // Hook this node to its parent
+                XRPL_ASSERT(
+                    dirty.parent->cowid() == cowid_,
+                    "ripple::SHAMap::walkInner : parent cowid do match");
+                dirty.parent->shareChild(dirty.branch, dirty.node);
+            }
+        }
 
-        // Continue with parent's next child, if any
-        node = std::move(parent);
-        ++pos;
+        // The parents hold the nodes of this level now
+        if (level->front().parent)
+            std::vector<Dirty>{}.swap(*level);
     }
 
-    // Last inner node is the new root_
-    root_ = std::move(node);
-
-    return flushed;
+    return intr_ptr::static_pointer_cast<SHAMapInnerNode>(
+        std::move(levels.front().front().node));
 }
 
 void
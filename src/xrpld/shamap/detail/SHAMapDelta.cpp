@@ -254,30 +254,46 @@ SHAMap::walkMap(std::vector<SHAMapMissingNode>& missingNodes, int maxMissing)
 
     nodeStack.push(intr_ptr::static_pointer_cast<SHAMapInnerNode>(root_));
 
+    auto const batchSize = fetchBatchParents();
+    std::vector<StackEntry> batch;
+    std::vector<SHAMapInnerNode*> parents;
+
     while (!nodeStack.empty())
     {
-        intr_ptr::SharedPtr<SHAMapInnerNode> node = std::move(nodeStack.top());
-        nodeStack.pop();
+        // Read the children of a batch of nodes at once
+        batch.clear();
+        parents.clear();
+        while (!nodeStack.empty() && batch.size() < batchSize)
+        {
+            parents.push_back(nodeStack.top().get());
+            batch.push_back(std::move(nodeStack.top()));
+            nodeStack.pop();
+        }
+        auto const children = fetchChildren(parents);
 
-        for (int i = 0; i < 16; ++i)
+        for (std::size_t j = 0; j < batch.size(); ++j)
         {
-            if (!node->isEmptyBranch(i))
+            auto const& node = batch[j];
+            for (int i = 0; i < 16; ++i)
             {
-                intr_ptr::SharedPtr<SHAMapTreeNode> nextNode =
-                    descendNoStore(*node, i);
-
-                if (nextNode)
-                {
-                    if (nextNode->isInner())
-                        nodeStack.push(
-                            intr_ptr::static_pointer_cast<SHAMapInnerNode>(
-                                nextNode));
-                }
-                else
+                if (!node->isEmptyBranch(i))
                 {
-                    missingNodes.emplace_back(type_, node->getChildHash(i));
-                    if (--maxMissing <= 0)
-                        return;
+                    auto const& nextNode = children[j][i];
+
+                    if (nextNode)
+                    {
+                        if (nextNode->isInner())
+                            nodeStack.push(
+                                intr_ptr::static_pointer_cast<SHAMapInnerNode>(
+                                    nextNode));
+                    }
+                    else
+                    {
+                        missingNodes.emplace_back(
+                            type_, node->getChildHash(i));
+                        if (--maxMissing <= 0)
+                            return;
+                    }
                 }
             }
         }
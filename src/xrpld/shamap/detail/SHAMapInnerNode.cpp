@@ -28,6 +28,8 @@
 #include <xrpl/protocol/HashPrefix.h>
 #include <xrpl/protocol/digest.h>
 
+#include <algorithm>
+
 namespace ripple {
 
 SHAMapInnerNode::SHAMapInnerNode(
@@ -215,6 +217,13 @@ SHAMapInnerNode::updateHash()
 
 void
 SHAMapInnerNode::updateHashDeep()
+{
+    updateChildHashes();
+    updateHash();
+}
+
+void
+SHAMapInnerNode::updateChildHashes()
 {
     SHAMapHash* hashes;
     intr_ptr::SharedPtr<SHAMapTreeNode>* children;
@@ -225,7 +234,6 @@ SHAMapInnerNode::updateHashDeep()
         if (auto p = children[indexNum].get())
             hashes[indexNum] = p->getHash();
     });
-    updateHash();
 }
 
 void
@@ -483,4 +491,22 @@ SHAMapInnerNode::invariants(bool is_root) const
         "ripple::SHAMapInnerNode::invariants : hash and count do match");
 }
 
+SHAMapInnerNode::ArenaCounts
+SHAMapInnerNode::getArenaCounts()
+{
+    ArenaCounts counts;
+    for (auto const& slab : arraySlabs)
+    {
+        // The counters are read while other threads update them, so don't
+        // let the difference wrap around.
+        auto const deallocations = slab.deallocations();
+        auto const allocations = std::max(slab.allocations(), deallocations);
+        counts.reserved += slab.reserved();
+        counts.used += (allocations - deallocations) * slab.size();
+        counts.allocations += allocations;
+        counts.deallocations += deallocations;
+    }
+    return counts;
+}
+
 }  // namespace ripple
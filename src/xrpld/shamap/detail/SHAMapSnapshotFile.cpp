@@ -0,0 +1,359 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <xrpld/shamap/SHAMap.h>
+#include <xrpld/shamap/SHAMapSnapshotFile.h>
+
+#include <xrpl/basics/contract.h>
+#include <xrpl/protocol/Serializer.h>
+#include <xrpl/protocol/digest.h>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <queue>
+
+namespace ripple {
+
+std::size_t
+SHAMapSnapshotFile::write(
+    boost::filesystem::path const& path,
+    Slice userData,
+    std::vector<SHAMap const*> const& maps,
+    std::size_t runSize)
+{
+    if (userData.size() > std::numeric_limits<std::uint32_t>::max())
+        Throw<std::runtime_error>("SHAMapSnapshotFile: user data too large");
+    runSize = std::max<std::size_t>(runSize, 1);
+
+    auto temp = path;
+    temp += ".tmp";
+    auto scratchPath = path;
+    scratchPath += ".index.tmp";
+
+    auto const removeScratch = [&]() {
+        boost::system::error_code ec;
+        boost::filesystem::remove(scratchPath, ec);
+    };
+
+    try
+    {
+        std::ofstream out;
+        out.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+        out.open(temp.string(), std::ios::binary | std::ios::trunc);
+
+        // The header is written again once the offsets are known
+        Header header{};
+        out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+        out.write(
+            reinterpret_cast<char const*>(userData.data()), userData.size());
+
+        auto const byHash = [](Entry const& a, Entry const& b) {
+            return a.hash < b.hash;
+        };
+
+        // Each full run is sorted and appended to the scratch file
+        std::fstream scratch;
+        scratch.exceptions(std::fstream::failbit | std::fstream::badbit);
+        std::vector<std::uint64_t> runs;
+        std::vector<Entry> run;
+        auto const spill = [&]() {
+            std::sort(run.begin(), run.end(), byHash);
+            if (!scratch.is_open())
+                scratch.open(
+                    scratchPath.string(),
+                    std::ios::in | std::ios::out | std::ios::binary |
+                        std::ios::trunc);
+            scratch.write(
+                reinterpret_cast<char const*>(run.data()),
+                run.size() * sizeof(Entry));
+            runs.push_back(run.size());
+            run.clear();
+        };
+
+        std::uint64_t const nodesOffset = sizeof(header) + userData.size();
+        std::uint64_t offset = nodesOffset;
+        Serializer s;
+        for (auto const map : maps)
+        {
+            map->visitNodesBatched([&](SHAMapTreeNode& node) {
+                // The root of an empty map is never read
+                auto const& hash = node.getHash().as_uint256();
+                if (hash.isZero())
+                    return true;
+
+                s.erase();
+                node.serializeWithPrefix(s);
+                out.write(reinterpret_cast<char const*>(s.data()), s.size());
+
+                auto& entry = run.emplace_back();
+                std::memcpy(entry.hash.data(), hash.data(), entry.hash.size());
+                entry.offset = offset;
+                entry.size = static_cast<std::uint32_t>(s.size());
+                offset += s.size();
+
+                if (run.size() == runSize)
+                    spill();
+                return true;
+            });
+        }
+
+        // The index is written as the runs are merged, one entry at a time,
+        // counting the entries in each slot of the fanout
+        std::vector<std::uint64_t> counts(fanoutSlots + 1, 0);
+        std::uint64_t written = 0;
+        std::array<std::uint8_t, uint256::bytes> last{};
+        auto const emit = [&](Entry const& entry) {
+            // A node in more than one of the maps is only indexed once
+            if (written != 0 && entry.hash == last)
+                return;
+            out.write(reinterpret_cast<char const*>(&entry), sizeof(entry));
+            ++counts[slot(entry.hash.data()) + 1];
+            last = entry.hash;
+            ++written;
+        };
+
+        if (runs.empty())
+        {
+            // Every entry fit in one run, so there is nothing to merge
+            std::sort(run.begin(), run.end(), byHash);
+            for (auto const& entry : run)
+                emit(entry);
+        }
+        else
+        {
+            if (!run.empty())
+                spill();
+            std::vector<Entry>{}.swap(run);
+
+            // A few entries of each run are read at a time
+            static constexpr std::size_t readSize = 1024;
+            struct Cursor
+            {
+                std::uint64_t next;
+                std::uint64_t end;
+                std::vector<Entry> entries;
+                std::size_t pos = 0;
+            };
+            std::vector<Cursor> cursors;
+            cursors.reserve(runs.size());
+            std::uint64_t begin = 0;
+            for (auto const size : runs)
+            {
+                cursors.push_back({begin, begin + size, {}, 0});
+                begin += size;
+            }
+
+            // Returns false once every entry of the run has been taken
+            auto const fill = [&](Cursor& c) {
+                if (c.pos < c.entries.size())
+                    return true;
+                if (c.next == c.end)
+                    return false;
+                auto const n =
+                    std::min<std::uint64_t>(readSize, c.end - c.next);
+                c.entries.resize(n);
+                scratch.seekg(c.next * sizeof(Entry));
+                scratch.read(
+                    reinterpret_cast<char*>(c.entries.data()),
+                    n * sizeof(Entry));
+                c.next += n;
+                c.pos = 0;
+                return true;
+            };
+
+            // The run whose next entry has the smallest hash is on top
+            auto const later = [&](std::size_t a, std::size_t b) {
+                return byHash(
+                    cursors[b].entries[cursors[b].pos],
+                    cursors[a].entries[cursors[a].pos]);
+            };
+            std::priority_queue<
+                std::size_t,
+                std::vector<std::size_t>,
+                decltype(later)>
+                heap(later);
+            for (std::size_t i = 0; i < cursors.size(); ++i)
+            {
+                if (fill(cursors[i]))
+                    heap.push(i);
+            }
+
+            while (!heap.empty())
+            {
+                auto const i = heap.top();
+                heap.pop();
+                auto& c = cursors[i];
+                emit(c.entries[c.pos++]);
+                if (fill(c))
+                    heap.push(i);
+            }
+
+            scratch.close();
+            removeScratch();
+        }
+
+        std::vector<boost::endian::little_uint64_buf_t> fanout(
+            fanoutSlots + 1);
+        std::uint64_t total = 0;
+        for (std::size_t i = 0; i <= fanoutSlots; ++i)
+        {
+            total += counts[i];
+            fanout[i] = total;
+        }
+
+        header.magic = magic_;
+        header.version = version_;
+        header.userSize = static_cast<std::uint32_t>(userData.size());
+        header.count = written;
+        header.nodesOffset = nodesOffset;
+        header.indexOffset = offset;
+        header.fanoutOffset = offset + written * sizeof(Entry);
+
+        out.write(
+            reinterpret_cast<char const*>(fanout.data()),
+            fanout.size() * sizeof(fanout[0]));
+        out.seekp(0);
+        out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+        out.close();
+
+        boost::filesystem::rename(temp, path);
+        return written;
+    }
+    catch (...)
+    {
+        boost::system::error_code ec;
+        boost::filesystem::remove(temp, ec);
+        removeScratch();
+        throw;
+    }
+}
+
+SHAMapSnapshotFile::SHAMapSnapshotFile(boost::filesystem::path const& path)
+    : path_(path)
+{
+    static_assert(sizeof(Header) == 48, "Header must not be padded");
+    static_assert(sizeof(Entry) == 44, "Entry must not be padded");
+
+    auto const fail = [&](std::string const& why) {
+        Throw<std::runtime_error>(
+            "SHAMapSnapshotFile: " + path.string() + ": " + why);
+    };
+
+    boost::system::error_code ec;
+    auto const fileSize = boost::filesystem::file_size(path, ec);
+    if (ec)
+        fail(ec.message());
+    if (fileSize < sizeof(Header))
+        fail("too small");
+
+    try
+    {
+        file_ = boost::interprocess::file_mapping(
+            path.string().c_str(), boost::interprocess::read_only);
+        region_ = boost::interprocess::mapped_region(
+            file_, boost::interprocess::read_only);
+    }
+    catch (boost::interprocess::interprocess_exception const& e)
+    {
+        fail(e.what());
+    }
+
+    // Nodes are read by hash, in no particular order, so reading ahead of
+    // them only wastes memory.
+    region_.advise(boost::interprocess::mapped_region::advice_random);
+
+    base_ = static_cast<std::uint8_t const*>(region_.get_address());
+    std::uint64_t const size = region_.get_size();
+
+    Header header;
+    std::memcpy(&header, base_, sizeof(header));
+    if (header.magic != magic_)
+        fail("not a snapshot");
+    if (header.version.value() != version_)
+        fail("unsupported version " + std::to_string(header.version.value()));
+
+    // Each part must follow the one before it, and the fanout must end the
+    // file. Every value is checked against the size of the file before it
+    // is used in arithmetic, so nothing can overflow.
+    std::uint64_t const count = header.count.value();
+    std::uint64_t const nodesOffset = header.nodesOffset.value();
+    std::uint64_t const indexOffset = header.indexOffset.value();
+    std::uint64_t const fanoutOffset = header.fanoutOffset.value();
+    std::uint64_t const fanoutSize =
+        (fanoutSlots + 1) * sizeof(boost::endian::little_uint64_buf_t);
+    if (nodesOffset != sizeof(Header) + header.userSize.value() ||
+        nodesOffset > indexOffset || indexOffset > fanoutOffset ||
+        fanoutOffset > size || size - fanoutOffset != fanoutSize ||
+        (fanoutOffset - indexOffset) / sizeof(Entry) != count ||
+        (fanoutOffset - indexOffset) % sizeof(Entry) != 0)
+    {
+        fail("malformed");
+    }
+
+    fanout_ = reinterpret_cast<boost::endian::little_uint64_buf_t const*>(
+        base_ + fanoutOffset);
+    for (std::size_t i = 0; i < fanoutSlots; ++i)
+    {
+        if (fanout_[i].value() > fanout_[i + 1].value())
+            fail("malformed fanout");
+    }
+    if (fanout_[fanoutSlots].value() != count)
+        fail("malformed fanout");
+
+    userData_ = Slice{base_ + sizeof(Header), header.userSize.value()};
+    count_ = count;
+    nodesBegin_ = nodesOffset;
+    nodesEnd_ = indexOffset;
+    index_ = reinterpret_cast<Entry const*>(base_ + indexOffset);
+}
+
+std::optional<Slice>
+SHAMapSnapshotFile::fetch(uint256 const& hash) const
+{
+    auto const s = slot(hash.data());
+    auto const first = index_ + fanout_[s].value();
+    auto const last = index_ + fanout_[s + 1].value();
+    auto const it = std::lower_bound(
+        first, last, hash, [](Entry const& entry, uint256 const& h) {
+            return std::memcmp(entry.hash.data(), h.data(), h.size()) < 0;
+        });
+    if (it == last || std::memcmp(it->hash.data(), hash.data(), hash.size()))
+        return std::nullopt;
+
+    // The entries are only checked when they are used, since checking them
+    // all when opening the file would read the whole index.
+    std::uint64_t const offset = it->offset.value();
+    std::uint64_t const size = it->size.value();
+    if (offset < nodesBegin_ || offset > nodesEnd_ || size > nodesEnd_ - offset)
+        return std::nullopt;
+
+    // A node is hashed from the same bytes it is stored as, so a damaged
+    // node can't pass for the one that was asked for
+    Slice const node{base_ + offset, size};
+    if (sha512Half(node) != hash)
+        return std::nullopt;
+
+    return node;
+}
+
+}  // namespace ripple
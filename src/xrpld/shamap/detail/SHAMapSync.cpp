@@ -22,6 +22,9 @@
 
 #include <xrpl/basics/random.h>
 
+#include <algorithm>
+#include <iterator>
+
 namespace ripple {
 
 void
@@ -98,6 +101,62 @@ SHAMap::visitNodes(std::function<bool(SHAMapTreeNode&)> const& function) const
     }
 }
 
+void
+SHAMap::visitNodesBatched(
+    std::function<bool(SHAMapTreeNode&)> const& function) const
+{
+    if (!root_)
+        return;
+
+    if (!function(*root_) || !root_->isInner())
+        return;
+
+    // Inner nodes whose children have yet to be visited. Taking each batch
+    // from the back walks the map depth first, so only a few levels of
+    // nodes are held at once.
+    std::vector<intr_ptr::SharedPtr<SHAMapInnerNode>> pending;
+    pending.push_back(intr_ptr::static_pointer_cast<SHAMapInnerNode>(root_));
+
+    auto const batchSize = fetchBatchParents();
+    std::vector<intr_ptr::SharedPtr<SHAMapInnerNode>> batch;
+    std::vector<SHAMapInnerNode*> parents;
+
+    while (!pending.empty())
+    {
+        auto const count = std::min(batchSize, pending.size());
+        batch.assign(
+            std::make_move_iterator(pending.end() - count),
+            std::make_move_iterator(pending.end()));
+        pending.resize(pending.size() - count);
+
+        parents.clear();
+        for (auto const& node : batch)
+            parents.push_back(node.get());
+        auto const children = fetchChildren(parents);
+
+        for (std::size_t i = 0; i < batch.size(); ++i)
+        {
+            for (int branch = 0; branch < branchFactor; ++branch)
+            {
+                if (batch[i]->isEmptyBranch(branch))
+                    continue;
+
+                auto const& child = children[i][branch];
+                if (!child)
+                    Throw<SHAMapMissingNode>(
+                        type_, batch[i]->getChildHash(branch));
+
+                if (!function(*child))
+                    return;
+
+                if (child->isInner())
+                    pending.push_back(
+                        intr_ptr::static_pointer_cast<SHAMapInnerNode>(child));
+            }
+        }
+    }
+}
+
 void
 SHAMap::visitDifferences(
     SHAMap const* have,
@@ -128,38 +187,63 @@ SHAMap::visitDifferences(
 
     stack.push({static_cast<SHAMapInnerNode*>(root_.get()), SHAMapNodeID{}});
 
+    auto const batchSize = fetchBatchParents();
+    std::vector<StackEntry> batch;
+    std::vector<SHAMapInnerNode*> parents;
+
     while (!stack.empty())
     {
-        auto const [node, nodeID] = stack.top();
-        stack.pop();
-
-        // 1) Add this node to the pack
-        if (!function(*node))
-            return;
+        // Read the children of a batch of nodes at once
+        batch.clear();
+        parents.clear();
+        while (!stack.empty() && batch.size() < batchSize)
+        {
+            batch.push_back(stack.top());
+            parents.push_back(stack.top().first);
+            stack.pop();
+        }
+        auto const children = fetchChildren(parents);
 
-        // 2) push non-matching child inner nodes
-        for (int i = 0; i < 16; ++i)
+        for (std::size_t j = 0; j < batch.size(); ++j)
         {
-            if (!node->isEmptyBranch(i))
-            {
-                auto const& childHash = node->getChildHash(i);
-                SHAMapNodeID childID = nodeID.getChildNodeID(i);
-                auto next = descendThrow(node, i);
+            auto const [node, nodeID] = batch[j];
 
-                if (next->isInner())
-                {
-                    if (!have || !have->hasInnerNode(childID, childHash))
-                        stack.push(
-                            {static_cast<SHAMapInnerNode*>(next), childID});
-                }
-                else if (
-                    !have ||
-                    !have->hasLeafNode(
-                        static_cast<SHAMapLeafNode*>(next)->peekItem()->key(),
-                        childHash))
+            // 1) Add this node to the pack
+            if (!function(*node))
+                return;
+
+            // 2) push non-matching child inner nodes
+            for (int i = 0; i < 16; ++i)
+            {
+                if (!node->isEmptyBranch(i))
                 {
-                    if (!function(*next))
-                        return;
+                    auto const& childHash = node->getChildHash(i);
+                    SHAMapNodeID childID = nodeID.getChildNodeID(i);
+                    if (!children[j][i])
+                        Throw<SHAMapMissingNode>(type_, childHash);
+
+                    // Keep the child, as descendThrow would
+                    auto next =
+                        node->canonicalizeChild(i, children[j][i]).get();
+
+                    if (next->isInner())
+                    {
+                        if (!have || !have->hasInnerNode(childID, childHash))
+                            stack.push(
+                                {static_cast<SHAMapInnerNode*>(next),
+                                 childID});
+                    }
+                    else if (
+                        !have ||
+                        !have->hasLeafNode(
+                            static_cast<SHAMapLeafNode*>(next)
+                                ->peekItem()
+                                ->key(),
+                            childHash))
+                    {
+                        if (!function(*next))
+                            return;
+                    }
                 }
             }
         }
@@ -30,6 +30,8 @@
 #include <xrpl/protocol/HashPrefix.h>
 #include <xrpl/protocol/digest.h>
 
+#include <vector>
+
 namespace ripple {
 
 intr_ptr::SharedPtr<SHAMapTreeNode>
@@ -178,6 +180,48 @@ SHAMapTreeNode::makeFromPrefix(Slice rawNode, SHAMapHash const& hash)
         ")");
 }
 
+void
+SHAMapTreeNode::updateHashes(
+    std::span<SHAMapTreeNode* const> nodes,
+    HashBuffers& buffers)
+{
+    buffers.nodes.clear();
+    buffers.messages.clear();
+
+    for (auto const node : nodes)
+    {
+        if (node->isInner())
+        {
+            auto const inner = static_cast<SHAMapInnerNode*>(node);
+            inner->updateChildHashes();
+
+            // An empty inner node hashes to zero, not to its serialization
+            if (inner->isEmpty())
+            {
+                inner->updateHash();
+                continue;
+            }
+        }
+
+        // Serialize into the storage of an earlier batch, if there is one
+        if (buffers.data.size() == buffers.nodes.size())
+            buffers.data.emplace_back();
+        auto& s = buffers.data[buffers.nodes.size()];
+        s.erase();
+        node->serializeWithPrefix(s);
+        buffers.nodes.push_back(node);
+    }
+
+    for (std::size_t i = 0; i < buffers.nodes.size(); ++i)
+        buffers.messages.push_back(buffers.data[i].slice());
+
+    buffers.digests.resize(buffers.nodes.size());
+    sha512HalfBatch(buffers.messages, buffers.digests);
+
+    for (std::size_t i = 0; i < buffers.nodes.size(); ++i)
+        buffers.nodes[i]->hash_ = SHAMapHash{buffers.digests[i]};
+}
+
 std::string
 SHAMapTreeNode::getString(SHAMapNodeID const& id) const
 {
@@ -0,0 +1,95 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <xrpld/shamap/SnapshotFamily.h>
+
+#include <xrpl/basics/Log.h>
+#include <xrpl/basics/TaggedCache.ipp>
+#include <xrpl/basics/chrono.h>
+#include <xrpl/basics/contract.h>
+
+namespace ripple {
+
+// Nodes are cheap to rebuild from a mapped file, so the tree node cache only
+// needs to hold the nodes of the queries in progress.
+static constexpr int treeCacheSize = 16384;
+static constexpr std::chrono::seconds treeCacheAge{30};
+
+SnapshotFamily::SnapshotFamily(
+    std::shared_ptr<SHAMapSnapshotFile const> file,
+    beast::Journal j)
+    : file_(std::move(file))
+    , j_(j)
+    , fbCache_(std::make_shared<FullBelowCache>(
+          "Snapshot family full below cache",
+          stopwatch(),
+          j))
+    , tnCache_(std::make_shared<TreeNodeCache>(
+          "Snapshot family tree node cache",
+          treeCacheSize,
+          treeCacheAge,
+          stopwatch(),
+          j))
+{
+}
+
+// SHAMap only asks its family for the database to fetch a node, which it
+// reads from snapshotFile() instead when there is one, or to write a node
+// it flushes. The maps of a snapshot are never modified, so they never flush.
+NodeStore::Database&
+SnapshotFamily::db()
+{
+    LogicError("SnapshotFamily::db : a snapshot has no database");
+}
+
+NodeStore::Database const&
+SnapshotFamily::db() const
+{
+    LogicError("SnapshotFamily::db : a snapshot has no database");
+}
+
+void
+SnapshotFamily::sweep()
+{
+    fbCache_->sweep();
+    tnCache_->sweep();
+}
+
+void
+SnapshotFamily::reset()
+{
+    fbCache_->reset();
+    tnCache_->reset();
+}
+
+void
+SnapshotFamily::missingNodeAcquireBySeq(std::uint32_t seq, uint256 const& hash)
+{
+    JLOG(j_.error()) << "Missing node " << hash << " of ledger " << seq
+                     << " in " << file_->path().string();
+}
+
+void
+SnapshotFamily::missingNodeAcquireByHash(uint256 const& hash, std::uint32_t seq)
+{
+    JLOG(j_.error()) << "Missing node of ledger " << seq << " (" << hash
+                     << ") in " << file_->path().string();
+}
+
+}  // namespace ripple
@@ -21,10 +21,10 @@
 #include <xrpld/shamap/detail/TaggedPointer.h>
 
 #include <xrpl/basics/ByteUtilities.h>
-
-#include <boost/pool/pool_alloc.hpp>
+#include <xrpl/basics/SlabAllocator.h>
 
 #include <array>
+#include <new>
 
 namespace ripple {
 
@@ -46,35 +46,42 @@ static_assert(
     boundaries.back() == SHAMapInnerNode::branchFactor,
     "Last element of boundaries must be number of children in a dense array");
 
-// Terminology: A chunk is the memory being allocated from a block. A block
-// contains multiple chunks. This is the terminology the boost documentation
-// uses. Pools use "Simple Segregated Storage" as their storage format.
+// Terminology: A chunk is the memory being allocated from a slab. A slab
+// contains multiple chunks. Each boundary has its own SlabAllocator, so the
+// tag of a pointer names the allocator that owns it.
 constexpr size_t elementSizeBytes =
     (sizeof(SHAMapHash) + sizeof(intr_ptr::SharedPtr<SHAMapTreeNode>));
 
-constexpr size_t blockSizeBytes = kilobytes(512);
-
-template <std::size_t... I>
-constexpr std::array<size_t, boundaries.size()>
-initArrayChunkSizeBytes(std::index_sequence<I...>)
-{
-    return std::array<size_t, boundaries.size()>{
-        boundaries[I] * elementSizeBytes...,
-    };
-}
-constexpr auto arrayChunkSizeBytes =
-    initArrayChunkSizeBytes(std::make_index_sequence<boundaries.size()>{});
+// The hashes are at the start of a chunk. Aligning chunks to 32 bytes keeps
+// every hash within one cache line, and the chunks of the two largest arrays
+// are aligned to whole cache lines. This costs a little padding: 16 bytes in
+// the chunks for two children and 16 bytes in those for six children, while
+// the chunks for four and sixteen children need none.
+constexpr std::array<std::size_t, boundaries.size()> chunkAlignment{
+    32,
+    32,
+    64,
+    64};
+
+// The slabs are large enough for the kernel to back them with huge pages.
+// Slabs are never released, so an idle server keeps the memory of the most
+// inner nodes it has ever held at once. The size is a power of two, so the
+// slabs are aligned to it and an array is returned to its slab without
+// searching the slabs.
+constexpr std::size_t slabSizeBytes = megabytes(std::size_t(8));
+static_assert((slabSizeBytes & (slabSizeBytes - 1)) == 0);
 
 template <std::size_t... I>
-constexpr std::array<size_t, boundaries.size()>
-initArrayChunksPerBlock(std::index_sequence<I...>)
+std::array<SlabAllocator<SHAMapHash>, boundaries.size()>
+initArraySlabs(std::index_sequence<I...>)
 {
-    return std::array<size_t, boundaries.size()>{
-        blockSizeBytes / arrayChunkSizeBytes[I]...,
-    };
+    return {SlabAllocator<SHAMapHash>{
+        boundaries[I] * elementSizeBytes - sizeof(SHAMapHash),
+        slabSizeBytes,
+        chunkAlignment[I]}...};
 }
-constexpr auto chunksPerBlock =
-    initArrayChunksPerBlock(std::make_index_sequence<boundaries.size()>{});
+std::array<SlabAllocator<SHAMapHash>, boundaries.size()> arraySlabs =
+    initArraySlabs(std::make_index_sequence<boundaries.size()>{});
 
 [[nodiscard]] inline std::uint8_t
 numAllocatedChildren(std::uint8_t n)
@@ -96,74 +103,22 @@ boundariesIndex(std::uint8_t numChildren)
         std::lower_bound(boundaries.begin(), boundaries.end(), numChildren));
 }
 
-template <std::size_t... I>
-std::array<std::function<void*()>, boundaries.size()>
-initAllocateArrayFuns(std::index_sequence<I...>)
-{
-    return std::array<std::function<void*()>, boundaries.size()>{
-        boost::singleton_pool<
-            boost::fast_pool_allocator_tag,
-            arrayChunkSizeBytes[I],
-            boost::default_user_allocator_new_delete,
-            std::mutex,
-            chunksPerBlock[I],
-            chunksPerBlock[I]>::malloc...,
-    };
-}
-std::array<std::function<void*()>, boundaries.size()> const allocateArrayFuns =
-    initAllocateArrayFuns(std::make_index_sequence<boundaries.size()>{});
-
-template <std::size_t... I>
-std::array<std::function<void(void*)>, boundaries.size()>
-initFreeArrayFuns(std::index_sequence<I...>)
-{
-    return std::array<std::function<void(void*)>, boundaries.size()>{
-        static_cast<void (*)(void*)>(boost::singleton_pool<
-                                     boost::fast_pool_allocator_tag,
-                                     arrayChunkSizeBytes[I],
-                                     boost::default_user_allocator_new_delete,
-                                     std::mutex,
-                                     chunksPerBlock[I],
-                                     chunksPerBlock[I]>::free)...,
-    };
-}
-std::array<std::function<void(void*)>, boundaries.size()> const freeArrayFuns =
-    initFreeArrayFuns(std::make_index_sequence<boundaries.size()>{});
-
-template <std::size_t... I>
-std::array<std::function<bool(void*)>, boundaries.size()>
-initIsFromArrayFuns(std::index_sequence<I...>)
-{
-    return std::array<std::function<bool(void*)>, boundaries.size()>{
-        boost::singleton_pool<
-            boost::fast_pool_allocator_tag,
-            arrayChunkSizeBytes[I],
-            boost::default_user_allocator_new_delete,
-            std::mutex,
-            chunksPerBlock[I],
-            chunksPerBlock[I]>::is_from...,
-    };
-}
-std::array<std::function<bool(void*)>, boundaries.size()> const
-    isFromArrayFuns =
-        initIsFromArrayFuns(std::make_index_sequence<boundaries.size()>{});
-
 // This function returns an untagged pointer
 [[nodiscard]] inline std::pair<std::uint8_t, void*>
 allocateArrays(std::uint8_t numChildren)
 {
     auto const i = boundariesIndex(numChildren);
-    return {i, allocateArrayFuns[i]()};
+    auto const p = arraySlabs[i].allocate();
+    if (p == nullptr)
+        throw std::bad_alloc();
+    return {i, p};
 }
 
 // This function takes an untagged pointer
 inline void
 deallocateArrays(std::uint8_t boundaryIndex, void* p)
 {
-    XRPL_ASSERT(
-        isFromArrayFuns[boundaryIndex](p),
-        "ripple::deallocateArrays : valid inputs");
-    freeArrayFuns[boundaryIndex](p);
+    arraySlabs[boundaryIndex].deallocateOwned(static_cast<std::uint8_t*>(p));
 }
 
 // Used in `iterChildren` and elsewhere as the hash value for sparse arrays when